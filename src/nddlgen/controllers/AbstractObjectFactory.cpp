@@ -18,7 +18,7 @@
 
 nddlgen::controllers::AbstractObjectFactory::AbstractObjectFactory()
 {
-
+	this->_isMatcherCompiled = true;
 }
 
 nddlgen::controllers::AbstractObjectFactory::~AbstractObjectFactory()
@@ -28,25 +28,46 @@ nddlgen::controllers::AbstractObjectFactory::~AbstractObjectFactory()
 
 nddlgen::models::AbstractObjectModelPtr nddlgen::controllers::AbstractObjectFactory::fromString(std::string modelName)
 {
-	std::string modelNameLc = boost::algorithm::to_lower_copy(modelName);
-
-	// Using reverse iterator, so that non-prefix-free keys are not matched wrong.
-	// ToDo: Sort desc. by string length. Better approach
-	for (ObjectModelMap::reverse_iterator i = this->_registeredObjectModels.rbegin();
-			i != this->_registeredObjectModels.rend(); i++)
+	if (!this->_isMatcherCompiled)
 	{
-		std::string classNameLc = boost::algorithm::to_lower_copy(i->first);
+		this->compileObjectModels();
+	}
+
+	int index = this->_matcher.findLongest(modelName);
 
-		if (modelNameLc == classNameLc || boost::algorithm::contains(modelNameLc, classNameLc))
-		{
-			return i->second();
-		}
+	if (index != -1)
+	{
+		return this->_matcherCreateFunctions[index]();
 	}
 
 	nddlgen::models::AbstractObjectModelPtr null(0);
 	return null;
 }
 
+void nddlgen::controllers::AbstractObjectFactory::compileObjectModels()
+{
+	boost::lock_guard<boost::mutex> lock(this->_matcherMutex);
+
+	// Compiled concurrently in the meantime
+	if (this->_isMatcherCompiled)
+	{
+		return;
+	}
+
+	std::vector<std::string> modelNames;
+	this->_matcherCreateFunctions.clear();
+
+	for (ObjectModelMap::iterator i = this->_registeredObjectModels.begin();
+			i != this->_registeredObjectModels.end(); i++)
+	{
+		modelNames.push_back(i->first);
+		this->_matcherCreateFunctions.push_back(i->second);
+	}
+
+	this->_matcher.compile(modelNames);
+	this->_isMatcherCompiled = true;
+}
+
 void nddlgen::controllers::AbstractObjectFactory::registerObjectModel(
 		std::string modelName,
 		CreateObject createFunction)
@@ -54,6 +75,7 @@ void nddlgen::controllers::AbstractObjectFactory::registerObjectModel(
 	std::string modelNameLc = boost::algorithm::to_lower_copy(modelName);
 
 	this->_registeredObjectModels[modelNameLc] = createFunction;
+	this->_isMatcherCompiled = false;
 }
 
 nddlgen::models::AbstractObjectModelPtr nddlgen::controllers::AbstractObjectFactory::createDefaultArm()
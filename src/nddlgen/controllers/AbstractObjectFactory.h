@@ -18,10 +18,14 @@
 #define NDDLGEN_CONTROLLER_NDDLGENERATABLEFACTORY_H_
 
 #include <map>
+#include <vector>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/atomic.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
 #include <nddlgen/models/AbstractObjectModel.h>
+#include <nddlgen/utilities/KeywordMatcher.h>
 
 #include <nddlgen/models/DefaultArmModel.h>
 #include <nddlgen/models/DefaultWorkspaceModel.h>
@@ -57,6 +61,23 @@ class nddlgen::controllers::AbstractObjectFactory
 		 */
 		ObjectModelMap _registeredObjectModels;
 
+		/**
+		 * Matcher compiled from the names of all registered NddlGeneratables, and their create
+		 * functions indexed like the names.
+		 */
+		nddlgen::utilities::KeywordMatcher _matcher;
+		std::vector<CreateObject> _matcherCreateFunctions;
+
+		/**
+		 * Flag to keep track if the matcher is compiled from all registered NddlGeneratables.
+		 */
+		boost::atomic<bool> _isMatcherCompiled;
+
+		/**
+		 * Mutex to compile the matcher only once if it is needed concurrently.
+		 */
+		boost::mutex _matcherMutex;
+
 		/**
 		 * Helper function to register a new NddlGeneratable.
 		 *
@@ -79,9 +100,9 @@ class nddlgen::controllers::AbstractObjectFactory
 
 		/**
 		 * Generate an NddlGeneratable from modelName. This method will match all registered
-		 * classes to the given modelName parameter. If either the lower case modelName is equal
-		 * to the lower case class name or the lower case modelName is contained in the lower
-		 * case class name, an instance of this class will be returned.
+		 * classes to the given modelName parameter. If the lower case class name is contained
+		 * in the lower case modelName, an instance of this class will be returned. If several
+		 * class names are contained, the longest one wins.
 		 *
 		 * @param modelName Name of the model
 		 *
@@ -97,6 +118,14 @@ class nddlgen::controllers::AbstractObjectFactory
 		 */
 		virtual void registerObjectModels() = 0;
 
+		/**
+		 * Compiles all registered NddlGeneratables, so fromString() matches a model name against
+		 * all of them in a single pass. Should be called after registerObjectModels(), which the
+		 * WorkflowControllerConfig does. Otherwise, the first call to fromString() after
+		 * registering NddlGeneratables compiles them.
+		 */
+		void compileObjectModels();
+
 		/**
 		 * Creates the default Arm NddlGeneratable model
 		 *
@@ -29,6 +29,25 @@ nddlgen::controllers::CollisionDetectionController::~CollisionDetectionControlle
 bool nddlgen::controllers::CollisionDetectionController::doesIntersect(
 		nddlgen::math::CuboidPtr box1,
 		nddlgen::math::CuboidPtr box2)
+{
+	int rejectedPairs = 0;
+
+	return CollisionDetectionController::doesIntersect(box1, box2, rejectedPairs);
+}
+
+boost::uint64_t nddlgen::controllers::CollisionDetectionController::doesIntersect(
+		nddlgen::math::CuboidPtr box,
+		const nddlgen::math::CuboidBlock& block)
+{
+	int rejectedPairs = 0;
+
+	return CollisionDetectionController::doesIntersect(box, block, rejectedPairs);
+}
+
+bool nddlgen::controllers::CollisionDetectionController::doesIntersect(
+		nddlgen::math::CuboidPtr box1,
+		nddlgen::math::CuboidPtr box2,
+		int& rejectedPairs)
 {
 	// Assert that box1 is set
 	if (!box1)
@@ -42,6 +61,44 @@ bool nddlgen::controllers::CollisionDetectionController::doesIntersect(
 		throw "Object bounding box was not set.";
 	}
 
+	// Boxes whose bounds do not overlap cannot intersect
+	if (!box1->doBoundsOverlap(*box2))
+	{
+		rejectedPairs++;
+		return false;
+	}
+
+	// Run collision detection
+	return nddlgen::math::OrientedBoundingBoxTest::doesIntersect(*box1, *box2);
+}
+
+boost::uint64_t nddlgen::controllers::CollisionDetectionController::doesIntersect(
+		nddlgen::math::CuboidPtr box,
+		const nddlgen::math::CuboidBlock& block,
+		int& rejectedPairs)
+{
+	// Assert that box is set
+	if (!box)
+	{
+		throw "Accessibility bounding box was not set.";
+	}
+
+	// Boxes whose bounds do not overlap cannot intersect
+	boost::uint64_t overlapping = block.findOverlappingBounds(*box);
+
+	for (int lane = 0; lane < block.getCount(); lane++)
+	{
+		if (!(overlapping & (((boost::uint64_t) 1) << lane)))
+		{
+			rejectedPairs++;
+		}
+	}
+
+	if (!overlapping)
+	{
+		return 0;
+	}
+
 	// Run collision detection
-	return nddlgen::math::SeparatingAxisTheoremTest::doesIntersect(box1, box2);
+	return nddlgen::math::BatchedSeparatingAxisTheoremTest::doesIntersect(*box, block) & overlapping;
 }
@@ -17,7 +17,12 @@
 #ifndef NDDLGEN_CONTROLLERS_COLLISIONDETECTIONCONTROLLER_H_
 #define NDDLGEN_CONTROLLERS_COLLISIONDETECTIONCONTROLLER_H_
 
+#include <boost/cstdint.hpp>
+
+#include <nddlgen/math/BatchedSeparatingAxisTheoremTest.h>
 #include <nddlgen/math/Cuboid.h>
+#include <nddlgen/math/CuboidBlock.h>
+#include <nddlgen/math/OrientedBoundingBoxTest.h>
 #include <nddlgen/math/SeparatingAxisTheoremTest.h>
 
 namespace nddlgen
@@ -52,7 +57,8 @@ class nddlgen::controllers::CollisionDetectionController
 
 		/**
 		 * Test for intersection between to objects. Eventually, this should be changed to
-		 * also allow cylindric shaped bounding boxes
+		 * also allow cylindric shaped bounding boxes. Pairs whose axis aligned bounds do not
+		 * overlap are rejected before running the separating axis test
 		 *
 		 * @param box1 First box
 		 * @param box2 Second box
@@ -61,6 +67,47 @@ class nddlgen::controllers::CollisionDetectionController
 		 */
 		static bool doesIntersect(nddlgen::math::CuboidPtr box1, nddlgen::math::CuboidPtr box2);
 
+		/**
+		 * Test for intersection between one object and a block of objects. Yields the same
+		 * results as testing each object of the block separately, but processes several
+		 * objects of the block at once.
+		 *
+		 * @param box Box
+		 * @param block Block of boxes
+		 *
+		 * @return Bit mask of hits. Bit i is set, if box intersects the box in lane i of block
+		 */
+		static boost::uint64_t doesIntersect(nddlgen::math::CuboidPtr box, const nddlgen::math::CuboidBlock& block);
+
+		/**
+		 * Test for intersection between to objects, counting a rejection by the axis aligned
+		 * bounds check. The counter is owned by the caller, so it should be kept per run or
+		 * per worker thread and summed up afterwards.
+		 *
+		 * @param box1 First box
+		 * @param box2 Second box
+		 * @param rejectedPairs Incremented, if the pair was rejected by its bounds
+		 *
+		 * @return True, if box1 and box2 intersect, false if not
+		 */
+		static bool doesIntersect(nddlgen::math::CuboidPtr box1, nddlgen::math::CuboidPtr box2,
+				int& rejectedPairs);
+
+		/**
+		 * Test for intersection between one object and a block of objects, counting the
+		 * objects of the block rejected by the axis aligned bounds check. The counter is owned
+		 * by the caller, so it should be kept per run or per worker thread and summed up
+		 * afterwards.
+		 *
+		 * @param box Box
+		 * @param block Block of boxes
+		 * @param rejectedPairs Incremented by the amount of objects rejected by their bounds
+		 *
+		 * @return Bit mask of hits. Bit i is set, if box intersects the box in lane i of block
+		 */
+		static boost::uint64_t doesIntersect(nddlgen::math::CuboidPtr box, const nddlgen::math::CuboidBlock& block,
+				int& rejectedPairs);
+
 };
 
 #endif
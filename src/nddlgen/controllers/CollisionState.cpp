@@ -0,0 +1,387 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/controllers/CollisionState.h>
+
+nddlgen::controllers::CollisionState::CollisionState()
+{
+	this->_wasIncremental = false;
+	this->_testedPairs = 0;
+	this->_rejectedPairs = 0;
+}
+
+nddlgen::controllers::CollisionState::~CollisionState()
+{
+
+}
+
+void nddlgen::controllers::CollisionState::update(
+		const std::vector<std::string>& names,
+		const std::vector<nddlgen::math::CuboidPtr>& accessibilityBoxes,
+		const std::vector<nddlgen::math::CuboidPtr>& objectBoxes,
+		nddlgen::utilities::ThreadPoolPtr threadPool)
+{
+	// If objects were added, removed or reordered, indices are not comparable anymore
+	bool hasSameObjects = !names.empty() && names == this->_names;
+
+	// Find all objects whose boxes changed since the last update
+	std::vector<int> changed;
+
+	for (int i = 0; hasSameObjects && i < (int) names.size(); i++)
+	{
+		if (!CollisionState::isSameBox(accessibilityBoxes[i], this->_accessibilityBoxes[i])
+				|| !CollisionState::isSameBox(objectBoxes[i], this->_objectBoxes[i]))
+		{
+			changed.push_back(i);
+		}
+	}
+
+	this->_names = names;
+	this->_accessibilityBoxes = accessibilityBoxes;
+	this->_objectBoxes = objectBoxes;
+
+	// If most objects moved, refitting would degrade the hierarchies and save little
+	if (!hasSameObjects || changed.size() * 2 > names.size())
+	{
+		this->rebuild(threadPool);
+	}
+	else
+	{
+		this->patch(changed);
+	}
+}
+
+const std::vector<int>& nddlgen::controllers::CollisionState::getBlockingObjects(int index) const
+{
+	return this->_blockingObjects[index];
+}
+
+const std::vector<int>& nddlgen::controllers::CollisionState::getPatchedObjects() const
+{
+	return this->_patchedObjects;
+}
+
+bool nddlgen::controllers::CollisionState::wasIncremental() const
+{
+	return this->_wasIncremental;
+}
+
+boost::uint64_t nddlgen::controllers::CollisionState::getTestedPairs() const
+{
+	return this->_testedPairs;
+}
+
+boost::uint64_t nddlgen::controllers::CollisionState::getRejectedPairs() const
+{
+	return this->_rejectedPairs;
+}
+
+void nddlgen::controllers::CollisionState::rebuild(nddlgen::utilities::ThreadPoolPtr threadPool)
+{
+	int count = this->_names.size();
+
+	// Build hierarchies over all boxes. Objects without a box get empty bounds, which never
+	// overlap anything, so item indices equal object indices
+	std::vector<nddlgen::math::AxisAlignedBoundingBox> accessibilityBounds;
+	std::vector<nddlgen::math::AxisAlignedBoundingBox> objectBounds;
+
+	for (int i = 0; i < count; i++)
+	{
+		accessibilityBounds.push_back(CollisionState::getBounds(this->_accessibilityBoxes[i]));
+		objectBounds.push_back(CollisionState::getBounds(this->_objectBoxes[i]));
+	}
+
+	this->_accessibilityHierarchy.build(accessibilityBounds);
+	this->_objectHierarchy.build(objectBounds);
+
+	// Test all objects, possibly in parallel
+	std::vector<int> testedPairs(count, 0);
+	std::vector<int> rejectedPairs(count, 0);
+
+	this->_blockingObjects.assign(count, std::vector<int>());
+	this->_blockedObjects.assign(count, std::vector<int>());
+
+	if (threadPool)
+	{
+		threadPool->parallelFor(count, boost::bind(&CollisionState::blockingObjectsHelper, this, _1,
+				boost::ref(testedPairs), boost::ref(rejectedPairs)));
+	}
+	else
+	{
+		for (int i = 0; i < count; i++)
+		{
+			this->blockingObjectsHelper(i, testedPairs, rejectedPairs);
+		}
+	}
+
+	// Derive reverse relations and statistics
+	this->_patchedObjects.clear();
+	this->_testedPairs = 0;
+	this->_rejectedPairs = 0;
+
+	for (int i = 0; i < count; i++)
+	{
+		foreach (int blockingObject, this->_blockingObjects[i])
+		{
+			this->_blockedObjects[blockingObject].push_back(i);
+		}
+
+		this->_patchedObjects.push_back(i);
+		this->_testedPairs += testedPairs[i];
+		this->_rejectedPairs += rejectedPairs[i];
+	}
+
+	this->_wasIncremental = false;
+}
+
+void nddlgen::controllers::CollisionState::patch(const std::vector<int>& changed)
+{
+	int count = this->_names.size();
+
+	std::vector<bool> isChanged(count, false);
+	std::vector<bool> isPatched(count, false);
+	int rejectedPairs = 0;
+
+	this->_testedPairs = 0;
+
+	// Move changed boxes within the hierarchies
+	foreach (int index, changed)
+	{
+		isChanged[index] = true;
+
+		this->_accessibilityHierarchy.refit(index, CollisionState::getBounds(this->_accessibilityBoxes[index]));
+		this->_objectHierarchy.refit(index, CollisionState::getBounds(this->_objectBoxes[index]));
+	}
+
+	// Changed objects may be blocked by any object, so test them completely. This also covers
+	// all pairs of two changed objects
+	foreach (int index, changed)
+	{
+		std::vector<int> previous = this->_blockingObjects[index];
+
+		foreach (int blockingObject, previous)
+		{
+			CollisionState::eraseSorted(this->_blockedObjects[blockingObject], index);
+		}
+
+		this->_testedPairs += this->findBlockingObjects(index, this->_blockingObjects[index], rejectedPairs);
+
+		foreach (int blockingObject, this->_blockingObjects[index])
+		{
+			CollisionState::insertSorted(this->_blockedObjects[blockingObject], index);
+		}
+
+		isPatched[index] = (previous != this->_blockingObjects[index]);
+	}
+
+	// Changed objects may block unchanged objects they did not block before, and vice versa
+	foreach (int index, changed)
+	{
+		// Drop all previous relations to unchanged objects, remembering them
+		std::vector<int> previous;
+		std::vector<int> blockedObjects = this->_blockedObjects[index];
+
+		foreach (int blockedObject, blockedObjects)
+		{
+			if (!isChanged[blockedObject])
+			{
+				CollisionState::eraseSorted(this->_blockingObjects[blockedObject], index);
+				CollisionState::eraseSorted(this->_blockedObjects[index], blockedObject);
+				previous.push_back(blockedObject);
+			}
+		}
+
+		// Test unchanged objects whose accessibility bounds overlap the new box
+		std::vector<int> candidates;
+
+		if (this->_objectBoxes[index])
+		{
+			this->_accessibilityHierarchy.query(CollisionState::getBounds(this->_objectBoxes[index]), candidates);
+		}
+
+		foreach (int candidate, candidates)
+		{
+			if (isChanged[candidate] || !this->_accessibilityBoxes[candidate])
+			{
+				continue;
+			}
+
+			this->_testedPairs++;
+
+			if (nddlgen::controllers::CollisionDetectionController::doesIntersect(
+					this->_accessibilityBoxes[candidate], this->_objectBoxes[index], rejectedPairs))
+			{
+				CollisionState::insertSorted(this->_blockingObjects[candidate], index);
+				CollisionState::insertSorted(this->_blockedObjects[index], candidate);
+
+				// Relations that existed before are no change
+				if (std::binary_search(previous.begin(), previous.end(), candidate))
+				{
+					CollisionState::eraseSorted(previous, candidate);
+				}
+				else
+				{
+					isPatched[candidate] = true;
+				}
+			}
+		}
+
+		// Relations that do not exist anymore
+		foreach (int blockedObject, previous)
+		{
+			isPatched[blockedObject] = true;
+		}
+	}
+
+	this->_patchedObjects.clear();
+
+	for (int i = 0; i < count; i++)
+	{
+		if (isPatched[i])
+		{
+			this->_patchedObjects.push_back(i);
+		}
+	}
+
+	this->_rejectedPairs = rejectedPairs;
+	this->_wasIncremental = true;
+}
+
+int nddlgen::controllers::CollisionState::findBlockingObjects(int index, std::vector<int>& result,
+		int& rejectedPairs)
+{
+	result.clear();
+
+	nddlgen::math::CuboidPtr accessibilityBox = this->_accessibilityBoxes[index];
+
+	if (!accessibilityBox)
+	{
+		return 0;
+	}
+
+	// Candidates in ascending order, so the result is sorted as well
+	std::vector<int> candidates;
+
+	this->_objectHierarchy.query(CollisionState::getBounds(accessibilityBox), candidates);
+	std::sort(candidates.begin(), candidates.end());
+
+	// Test candidates in blocks
+	nddlgen::math::CuboidBlock block;
+	std::vector<int> blockObjects;
+	int testedPairs = 0;
+
+	for (int i = 0; i <= (int) candidates.size(); i++)
+	{
+		bool isLast = (i == (int) candidates.size());
+
+		// Only run collision detection if both are not the same object
+		if (!isLast && candidates[i] != index && this->_objectBoxes[candidates[i]])
+		{
+			block.add(*this->_objectBoxes[candidates[i]]);
+			blockObjects.push_back(candidates[i]);
+		}
+
+		if (block.isFull() || (isLast && block.getCount() > 0))
+		{
+			boost::uint64_t hits = nddlgen::controllers::CollisionDetectionController::doesIntersect(
+					accessibilityBox, block, rejectedPairs);
+
+			for (int lane = 0; lane < block.getCount(); lane++)
+			{
+				if (hits & (((boost::uint64_t) 1) << lane))
+				{
+					result.push_back(blockObjects[lane]);
+				}
+			}
+
+			testedPairs += block.getCount();
+
+			block.clear();
+			blockObjects.clear();
+		}
+	}
+
+	return testedPairs;
+}
+
+void nddlgen::controllers::CollisionState::blockingObjectsHelper(int index, std::vector<int>& testedPairs,
+		std::vector<int>& rejectedPairs)
+{
+	testedPairs[index] = this->findBlockingObjects(index, this->_blockingObjects[index], rejectedPairs[index]);
+}
+
+bool nddlgen::controllers::CollisionState::isSameBox(nddlgen::math::CuboidPtr box1,
+		nddlgen::math::CuboidPtr box2)
+{
+	if (box1 == box2)
+	{
+		return true;
+	}
+
+	if (!box1 || !box2)
+	{
+		return false;
+	}
+
+	// Compare closed forms
+	const nddlgen::math::Vector3* vectors1[5] = {
+			&box1->getCenter(), &box1->getHalfExtents(), &box1->getAxis(0), &box1->getAxis(1), &box1->getAxis(2)
+	};
+	const nddlgen::math::Vector3* vectors2[5] = {
+			&box2->getCenter(), &box2->getHalfExtents(), &box2->getAxis(0), &box2->getAxis(1), &box2->getAxis(2)
+	};
+
+	for (int i = 0; i < 5; i++)
+	{
+		if (vectors1[i]->x != vectors2[i]->x || vectors1[i]->y != vectors2[i]->y || vectors1[i]->z != vectors2[i]->z)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+nddlgen::math::AxisAlignedBoundingBox nddlgen::controllers::CollisionState::getBounds(
+		nddlgen::math::CuboidPtr box)
+{
+	if (!box)
+	{
+		return nddlgen::math::AxisAlignedBoundingBox();
+	}
+
+	return nddlgen::math::AxisAlignedBoundingBox::fromCuboid(box);
+}
+
+void nddlgen::controllers::CollisionState::insertSorted(std::vector<int>& list, int value)
+{
+	std::vector<int>::iterator position = std::lower_bound(list.begin(), list.end(), value);
+
+	if (position == list.end() || *position != value)
+	{
+		list.insert(position, value);
+	}
+}
+
+void nddlgen::controllers::CollisionState::eraseSorted(std::vector<int>& list, int value)
+{
+	std::vector<int>::iterator position = std::lower_bound(list.begin(), list.end(), value);
+
+	if (position != list.end() && *position == value)
+	{
+		list.erase(position);
+	}
+}
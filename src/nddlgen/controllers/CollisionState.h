@@ -0,0 +1,237 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_CONTROLLERS_COLLISIONSTATE_H_
+#define NDDLGEN_CONTROLLERS_COLLISIONSTATE_H_
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <nddlgen/controllers/CollisionDetectionController.h>
+#include <nddlgen/math/AxisAlignedBoundingBox.h>
+#include <nddlgen/math/BoundingVolumeHierarchy.h>
+#include <nddlgen/math/Cuboid.h>
+#include <nddlgen/math/CuboidBlock.h>
+#include <nddlgen/utilities/Foreach.hpp>
+#include <nddlgen/utilities/ThreadPool.h>
+
+namespace nddlgen
+{
+	namespace controllers
+	{
+		class CollisionState;
+		typedef boost::shared_ptr<nddlgen::controllers::CollisionState> CollisionStatePtr;
+	}
+}
+
+/**
+ * Persistent result of the collision detection, which can be updated incrementally. Keeps a
+ * bounding volume hierarchy over the accessibility and one over the object bounding boxes, and
+ * the blocking relations of the last update.
+ *
+ * If an update contains the same objects (by name and order) as the previous one, only the
+ * objects whose bounding boxes changed are refitted within the hierarchies, and only pairs
+ * involving them are tested again. Otherwise, everything is computed from scratch.
+ *
+ * Objects are addressed by their index within the lists passed to update().
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::controllers::CollisionState
+{
+
+	private:
+
+		/**
+		 * Names of all objects of the last update.
+		 */
+		std::vector<std::string> _names;
+
+		/**
+		 * Accessibility bounding boxes of the last update. Null for objects without one.
+		 */
+		std::vector<nddlgen::math::CuboidPtr> _accessibilityBoxes;
+
+		/**
+		 * Object bounding boxes of the last update. Null for objects without one.
+		 */
+		std::vector<nddlgen::math::CuboidPtr> _objectBoxes;
+
+		/**
+		 * Hierarchy over the accessibility bounding boxes, item indices equal object indices.
+		 */
+		nddlgen::math::BoundingVolumeHierarchy _accessibilityHierarchy;
+
+		/**
+		 * Hierarchy over the object bounding boxes, item indices equal object indices.
+		 */
+		nddlgen::math::BoundingVolumeHierarchy _objectHierarchy;
+
+		/**
+		 * Objects blocking each object, in ascending order.
+		 */
+		std::vector<std::vector<int> > _blockingObjects;
+
+		/**
+		 * Objects blocked by each object, in ascending order.
+		 */
+		std::vector<std::vector<int> > _blockedObjects;
+
+		/**
+		 * Objects whose blocking objects changed during the last update.
+		 */
+		std::vector<int> _patchedObjects;
+
+		/**
+		 * True, if the last update was done incrementally.
+		 */
+		bool _wasIncremental;
+
+		/**
+		 * Amount of pairs tested during the last update.
+		 */
+		boost::uint64_t _testedPairs;
+
+		/**
+		 * Amount of pairs rejected by comparing their axis aligned bounds during the last update.
+		 */
+		boost::uint64_t _rejectedPairs;
+
+		/**
+		 * Computes everything from scratch.
+		 *
+		 * @param threadPool Thread pool to test the objects in parallel
+		 */
+		void rebuild(nddlgen::utilities::ThreadPoolPtr threadPool);
+
+		/**
+		 * Updates the blocking relations of the given changed objects.
+		 *
+		 * @param changed Indices of changed objects, in ascending order
+		 */
+		void patch(const std::vector<int>& changed);
+
+		/**
+		 * Computes the objects blocking one object.
+		 *
+		 * @param index Index of the object
+		 * @param result Receives the indices of the blocking objects, in ascending order
+		 * @param rejectedPairs Incremented by the amount of pairs rejected by their bounds
+		 *
+		 * @return Amount of tested pairs
+		 */
+		int findBlockingObjects(int index, std::vector<int>& result, int& rejectedPairs);
+
+		/**
+		 * Helper to run findBlockingObjects() for several objects in parallel. The counts
+		 * are kept per object and summed up after all objects were tested.
+		 */
+		void blockingObjectsHelper(int index, std::vector<int>& testedPairs, std::vector<int>& rejectedPairs);
+
+		/**
+		 * Tests if two boxes are the same, either by identity or by their closed form.
+		 *
+		 * @return True, if both are null or describe the same cuboid, false if not.
+		 */
+		static bool isSameBox(nddlgen::math::CuboidPtr box1, nddlgen::math::CuboidPtr box2);
+
+		/**
+		 * Gets the world space bounds of a box, or empty bounds for null.
+		 */
+		static nddlgen::math::AxisAlignedBoundingBox getBounds(nddlgen::math::CuboidPtr box);
+
+		/**
+		 * Helpers to maintain sorted index lists.
+		 */
+		static void insertSorted(std::vector<int>& list, int value);
+		static void eraseSorted(std::vector<int>& list, int value);
+
+	public:
+
+		/**
+		 * Constructs a new, empty collision state.
+		 */
+		CollisionState();
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~CollisionState();
+
+		/**
+		 * Updates the state to the given objects and bounding boxes. All lists must be of the
+		 * same size.
+		 *
+		 * @param names Unique names of all objects
+		 * @param accessibilityBoxes Accessibility bounding box of each object, or null
+		 * @param objectBoxes Object bounding box of each object, or null
+		 * @param threadPool Thread pool used if everything is computed from scratch
+		 */
+		void update(
+				const std::vector<std::string>& names,
+				const std::vector<nddlgen::math::CuboidPtr>& accessibilityBoxes,
+				const std::vector<nddlgen::math::CuboidPtr>& objectBoxes,
+				nddlgen::utilities::ThreadPoolPtr threadPool
+		);
+
+		/**
+		 * Gets the objects blocking an object.
+		 *
+		 * @param index Index of the object
+		 *
+		 * @return Indices of all blocking objects, in ascending order.
+		 */
+		const std::vector<int>& getBlockingObjects(int index) const;
+
+		/**
+		 * Gets the objects whose blocking objects changed during the last update. After an
+		 * update from scratch, these are all objects.
+		 *
+		 * @return Indices of all patched objects, in ascending order.
+		 */
+		const std::vector<int>& getPatchedObjects() const;
+
+		/**
+		 * Tests if the last update was done incrementally.
+		 *
+		 * @return True, if only changed objects were tested again, false if everything was
+		 * computed from scratch.
+		 */
+		bool wasIncremental() const;
+
+		/**
+		 * Gets the amount of pairs tested during the last update.
+		 *
+		 * @return Amount of tested pairs.
+		 */
+		boost::uint64_t getTestedPairs() const;
+
+		/**
+		 * Gets the amount of pairs rejected by the axis aligned bounds check during the last
+		 * update, without running the separating axis test.
+		 *
+		 * @return Amount of rejected pairs.
+		 */
+		boost::uint64_t getRejectedPairs() const;
+
+};
+
+#endif
@@ -18,7 +18,11 @@
 
 nddlgen::controllers::DomainDescriptionFactory::DomainDescriptionFactory()
 {
-
+	this->_broadPhase.reset(new nddlgen::math::BruteForceBroadPhase());
+	this->_threadPool.reset(new nddlgen::utilities::ThreadPool(1));
+	this->_parallelObjectCreation = false;
+	this->_testedPairs = 0;
+	this->_rejectedPairs = 0;
 }
 
 nddlgen::controllers::DomainDescriptionFactory::~DomainDescriptionFactory()
@@ -29,6 +33,19 @@ nddlgen::controllers::DomainDescriptionFactory::~DomainDescriptionFactory()
 nddlgen::models::DomainDescriptionModelPtr nddlgen::controllers::DomainDescriptionFactory::build(
 		nddlgen::types::SdfRoot sdfRoot,
 		nddlgen::types::IsdRoot isdRoot)
+{
+	nddlgen::utilities::SceneRecordPtr scene = nddlgen::utilities::SceneRecord::fromSdf(sdfRoot);
+
+	if (isdRoot)
+	{
+		scene->addGoalsFromIsd(isdRoot);
+	}
+
+	return this->build(scene);
+}
+
+nddlgen::models::DomainDescriptionModelPtr nddlgen::controllers::DomainDescriptionFactory::build(
+		nddlgen::utilities::SceneRecordPtr scene)
 {
 	// Assert that a model factory was set
 	if (!this->_objectFactory)
@@ -52,10 +69,10 @@ nddlgen::models::DomainDescriptionModelPtr nddlgen::controllers::DomainDescripti
 	domainDescription->setInitialState(initialState);
 
 	// Populate DDM with the models defined in the SDF
-	this->populateWithObjectsFromSdf(domainDescription, sdfRoot);
+	this->populateWithObjectsFromSdf(domainDescription, scene);
 
 	// Populate DDM with the goals defined in the ISD
-	this->populateWithGoalsFromIsd(domainDescription, isdRoot);
+	this->populateWithGoalsFromIsd(domainDescription, scene);
 
 	// Populate DDM with the sub objects as defined in each NddlGeneratable
 	this->populateWithSubObjects(domainDescription);
@@ -85,19 +102,104 @@ void nddlgen::controllers::DomainDescriptionFactory::setObjectFactory(
 	this->_objectFactory = modelFactory;
 }
 
+void nddlgen::controllers::DomainDescriptionFactory::setBroadPhase(
+		nddlgen::math::AbstractBroadPhasePtr broadPhase)
+{
+	this->_broadPhase = broadPhase;
+}
+
+void nddlgen::controllers::DomainDescriptionFactory::setThreadPool(
+		nddlgen::utilities::ThreadPoolPtr threadPool)
+{
+	this->_threadPool = threadPool;
+}
+
+void nddlgen::controllers::DomainDescriptionFactory::setParallelObjectCreation(
+		bool parallelObjectCreation)
+{
+	this->_parallelObjectCreation = parallelObjectCreation;
+}
+
+void nddlgen::controllers::DomainDescriptionFactory::setCollisionState(
+		nddlgen::controllers::CollisionStatePtr collisionState)
+{
+	this->_collisionState = collisionState;
+}
+
+void nddlgen::controllers::DomainDescriptionFactory::updateBlockedObjects(
+		nddlgen::models::DomainDescriptionModelPtr domainDescription)
+{
+	if (!this->_collisionState)
+	{
+		this->_collisionState.reset(new nddlgen::controllers::CollisionState());
+	}
+
+	// Get all models on workspace
+	nddlgen::types::ObjectModelList models = domainDescription->getArm()->getWorkspace()->getObjects();
+
+	this->collisionStateUpdateHelper(models);
+
+	// If objects were added or removed, ids changed and all objects were patched anyway
+	nddlgen::models::BlockingMatrixPtr blockingMatrix = domainDescription->getBlockingMatrix();
+
+	if (blockingMatrix->getObjectCount() != (int) models.size())
+	{
+		blockingMatrix->resize(models.size());
+	}
+
+	// Replace blocking objects of all models that were affected by the changes
+	foreach (int index, this->_collisionState->getPatchedObjects())
+	{
+		models[index]->clearBlockingObjects();
+		blockingMatrix->clearBlockingObjects(index);
+
+		foreach (int blockingObject, this->_collisionState->getBlockingObjects(index))
+		{
+			models[index]->addBlockingObject(models[blockingObject]);
+			blockingMatrix->set(index, blockingObject);
+		}
+	}
+}
+
+boost::uint64_t nddlgen::controllers::DomainDescriptionFactory::getTestedPairs()
+{
+	return this->_testedPairs;
+}
+
+boost::uint64_t nddlgen::controllers::DomainDescriptionFactory::getRejectedPairs()
+{
+	return this->_rejectedPairs;
+}
+
 void nddlgen::controllers::DomainDescriptionFactory::populateWithObjectsFromSdf(
 		nddlgen::models::DomainDescriptionModelPtr domainDescription,
-		nddlgen::types::SdfRoot sdfRoot)
+		nddlgen::utilities::SceneRecordPtr scene)
 {
 	// Initialize needed variables
 	nddlgen::models::DefaultWorkspaceModelPtr workspace = domainDescription->getArm()->getWorkspace();
-	sdf::ElementPtr currentModelElement = sdfRoot->root->GetElement("world")->GetElement("model");
 
-	// Iterate through elements in SDF model node
-	while (currentModelElement)
+	// Instantiate all models of the SDF world first, indexed like the models
+	std::vector<nddlgen::utilities::SceneRecord::Model>& models = scene->getModels();
+	std::vector<nddlgen::models::AbstractObjectModelPtr> instances(models.size());
+
+	if (this->_parallelObjectCreation)
 	{
-		nddlgen::models::AbstractObjectModelPtr generatableModel = this->objectFactory(currentModelElement);
+		this->_threadPool->parallelFor((int) models.size(), boost::bind(
+				&DomainDescriptionFactory::objectPopulationHelper, this, _1, boost::ref(models),
+				boost::ref(instances)));
+	}
+	else
+	{
+		for (int i = 0; i < (int) models.size(); i++)
+		{
+			this->objectPopulationHelper(i, models, instances);
+		}
+	}
 
+	// Add instances in document order, so the workspace does not depend on the order they
+	// were instantiated in
+	foreach (nddlgen::models::AbstractObjectModelPtr generatableModel, instances)
+	{
 		// If generatableModel is null, it is not supported by the given model factory
 		// and will therefore be ignored and not added to the workspace
 		if (generatableModel)
@@ -105,31 +207,23 @@ void nddlgen::controllers::DomainDescriptionFactory::populateWithObjectsFromSdf(
 			// First add generatableModel to workspace to make sure that it is initialized properly
 			workspace->addObjectToWorkspace(generatableModel);
 		}
-
-		// Iterate
-		currentModelElement = currentModelElement->GetNextElement("model");
 	}
 }
 
 void nddlgen::controllers::DomainDescriptionFactory::populateWithGoalsFromIsd(
 		nddlgen::models::DomainDescriptionModelPtr domainDescription,
-		nddlgen::types::IsdRoot isdRoot)
+		nddlgen::utilities::SceneRecordPtr scene)
 {
 	nddlgen::models::InitialStateModelPtr initialState = domainDescription->getInitialState();
 
-	TiXmlHandle isdRootHandle(isdRoot->RootElement());
-	TiXmlElement* goals = isdRootHandle.FirstChild("goals").FirstChild("goal").ToElement();
-
-	// Iterate through goals and add them to initial state model
-	for (; goals; goals = goals->NextSiblingElement())
+	// Iterate through goals and add them to initial state model. The goals point into the
+	// buffers of the scene record instead of copying them, so they keep the record alive
+	foreach (const nddlgen::utilities::SceneRecord::Goal& goalRecord, scene->getGoals())
 	{
 		nddlgen::models::InitialStateGoalModelPtr goal(new nddlgen::models::InitialStateGoalModel());
 
-		goal->setGoalName(goals->Attribute("name"));
-		goal->setObjectName(goals->Attribute("for"));
-		goal->setPredicate(goals->Attribute("predicate"));
-		goal->setStartsAfter(goals->Attribute("starts-after"));
-		goal->setEndsBefore(goals->Attribute("ends-before"));
+		goal->setViews(goalRecord.name, goalRecord.objectName, goalRecord.predicate,
+				goalRecord.startsAfter, goalRecord.endsBefore, scene);
 
 		initialState->addGoal(goal);
 	}
@@ -175,32 +269,90 @@ void nddlgen::controllers::DomainDescriptionFactory::populateWithBlockedObjects(
 	// Get all models on workspace
 	nddlgen::types::ObjectModelList models = domainDescription->getArm()->getWorkspace()->getObjects();
 
-	// Use this...
-	foreach (nddlgen::models::AbstractObjectModelPtr model1, models)
+	// Blocking relations by object id, which is the index on the workspace
+	nddlgen::models::BlockingMatrixPtr blockingMatrix = domainDescription->getBlockingMatrix();
+	blockingMatrix->resize(models.size());
+
+	// If there is a persistent state, only retest what changed since it was last updated
+	if (this->_collisionState)
 	{
-		// ...and this foreach loop to form all permutations (naive, may be improved)
-		foreach (nddlgen::models::AbstractObjectModelPtr model2, models)
+		this->collisionStateUpdateHelper(models);
+
+		for (int i = 0; i < (int) models.size(); i++)
 		{
-			// Only run collision detection if model1 and model2 are not the same object
-			if (model1 != model2)
+			foreach (int blockingObject, this->_collisionState->getBlockingObjects(i))
 			{
-				// Accessibility bounding box of model1 and object bounding box of model2 need to be set
-				if (model1->hasAccessibilityBoundingBox() && model2->hasObjectBoundingBox())
-				{
-					// Run collision detection and save result
-					bool doBoundingBoxesIntersect = nddlgen::controllers::CollisionDetectionController::doesIntersect(
-							model1->getAccessibilityBoundingBox(),
-							model2->getObjectBoundingBox()
-					);
-
-					// If the bounding boxes intersect, instruct model1 that it is blocked by model2
-					if (doBoundingBoxesIntersect)
-					{
-						model1->addBlockingObject(model2);
-					}
-				}
+				models[i]->addBlockingObject(models[blockingObject]);
+				blockingMatrix->set(i, blockingObject);
 			}
 		}
+
+		return;
+	}
+
+	// Models having an accessibility or object bounding box, and the world space bounds of these boxes
+	std::vector<int> accessibilityModels;
+	std::vector<int> objectModels;
+	std::vector<nddlgen::math::AxisAlignedBoundingBox> accessibilityBounds;
+	std::vector<nddlgen::math::AxisAlignedBoundingBox> objectBounds;
+
+	for (int i = 0; i < (int) models.size(); i++)
+	{
+		if (models[i]->hasAccessibilityBoundingBox())
+		{
+			accessibilityModels.push_back(i);
+			accessibilityBounds.push_back(nddlgen::math::AxisAlignedBoundingBox::fromCuboid(
+					models[i]->getAccessibilityBoundingBox()));
+		}
+
+		if (models[i]->hasObjectBoundingBox())
+		{
+			objectModels.push_back(i);
+			objectBounds.push_back(nddlgen::math::AxisAlignedBoundingBox::fromCuboid(
+					models[i]->getObjectBoundingBox()));
+		}
+	}
+
+	// Let the broad phase determine which pairs may collide at all
+	nddlgen::math::CandidateList candidates = this->_broadPhase->findCandidates(accessibilityBounds, objectBounds);
+
+	// Resolve candidates to object ids. Candidates are in ascending order, so blocking objects
+	// are added in the same order as if all permutations were tested
+	std::vector<std::vector<int> > candidateObjects(accessibilityModels.size());
+
+	for (int i = 0; i < (int) accessibilityModels.size(); i++)
+	{
+		foreach (int candidate, candidates[i])
+		{
+			candidateObjects[i].push_back(objectModels[candidate]);
+		}
+	}
+
+	// Run collision detection for all models, possibly in parallel. Results are collected per
+	// model, so they do not depend on the order the models are processed in
+	std::vector<std::vector<int> > blockingObjects(accessibilityModels.size());
+	std::vector<int> testedPairs(accessibilityModels.size(), 0);
+	std::vector<int> rejectedPairs(accessibilityModels.size(), 0);
+
+	this->_threadPool->parallelFor((int) accessibilityModels.size(), boost::bind(
+			&DomainDescriptionFactory::blockedObjectsPopulationHelper, this, _1, boost::cref(models),
+			boost::cref(accessibilityModels), boost::cref(candidateObjects), boost::ref(blockingObjects),
+			boost::ref(testedPairs), boost::ref(rejectedPairs)));
+
+	this->_testedPairs = 0;
+	this->_rejectedPairs = 0;
+
+	// Instruct each model by which models it is blocked, and record it in the blocking matrix
+	for (int i = 0; i < (int) accessibilityModels.size(); i++)
+	{
+		foreach (int blockingObject, blockingObjects[i])
+		{
+			models[accessibilityModels[i]]->addBlockingObject(models[blockingObject]);
+			blockingMatrix->set(accessibilityModels[i], blockingObject);
+		}
+
+		this->_testedPairs += testedPairs[i];
+		this->_rejectedPairs += rejectedPairs[i];
 	}
 }
 
@@ -250,6 +402,14 @@ void nddlgen::controllers::DomainDescriptionFactory::populateWithUsedNddlClasses
 	}
 }
 
+void nddlgen::controllers::DomainDescriptionFactory::objectPopulationHelper(
+		int index,
+		std::vector<nddlgen::utilities::SceneRecord::Model>& models,
+		std::vector<nddlgen::models::AbstractObjectModelPtr>& instances)
+{
+	instances[index] = this->objectFactory(models[index]);
+}
+
 void nddlgen::controllers::DomainDescriptionFactory::subObjectPopulationHelper(
 		nddlgen::models::AbstractObjectModelPtr model,
 				std::map<std::string, int> indices)
@@ -343,48 +503,129 @@ void nddlgen::controllers::DomainDescriptionFactory::actionsPopulationHelper(
 	model->initActions();
 }
 
+void nddlgen::controllers::DomainDescriptionFactory::collisionStateUpdateHelper(
+		const nddlgen::types::ObjectModelList& models)
+{
+	std::vector<std::string> names;
+	std::vector<nddlgen::math::CuboidPtr> accessibilityBoxes;
+	std::vector<nddlgen::math::CuboidPtr> objectBoxes;
+
+	foreach (nddlgen::models::AbstractObjectModelPtr model, models)
+	{
+		names.push_back(model->getName());
+		accessibilityBoxes.push_back(model->getAccessibilityBoundingBox());
+		objectBoxes.push_back(model->getObjectBoundingBox());
+	}
+
+	this->_collisionState->update(names, accessibilityBoxes, objectBoxes, this->_threadPool);
+
+	this->_testedPairs = this->_collisionState->getTestedPairs();
+	this->_rejectedPairs = this->_collisionState->getRejectedPairs();
+}
+
+void nddlgen::controllers::DomainDescriptionFactory::blockedObjectsPopulationHelper(
+		int index,
+		const nddlgen::types::ObjectModelList& models,
+		const std::vector<int>& accessibilityModels,
+		const std::vector<std::vector<int> >& candidates,
+		std::vector<std::vector<int> >& blockingObjects,
+		std::vector<int>& testedPairs,
+		std::vector<int>& rejectedPairs)
+{
+	int id1 = accessibilityModels[index];
+	nddlgen::models::AbstractObjectModelPtr model1 = models[id1];
+
+	// The object bounding boxes of the candidates are collected in blocks to test several of
+	// them at once
+	nddlgen::math::CuboidBlock block;
+	std::vector<int> blockModels;
+
+	foreach (int id2, candidates[index])
+	{
+		// Only run collision detection if model1 and model2 are not the same object
+		if (id1 != id2)
+		{
+			block.add(*models[id2]->getObjectBoundingBox());
+			blockModels.push_back(id2);
+
+			if (block.isFull())
+			{
+				testedPairs[index] += block.getCount();
+				this->blockedObjectsBlockHelper(model1, block, blockModels, blockingObjects[index],
+						rejectedPairs[index]);
+			}
+		}
+	}
+
+	if (block.getCount() > 0)
+	{
+		testedPairs[index] += block.getCount();
+		this->blockedObjectsBlockHelper(model1, block, blockModels, blockingObjects[index],
+				rejectedPairs[index]);
+	}
+}
+
+void nddlgen::controllers::DomainDescriptionFactory::blockedObjectsBlockHelper(
+		nddlgen::models::AbstractObjectModelPtr model,
+		nddlgen::math::CuboidBlock& block,
+		std::vector<int>& blockModels,
+		std::vector<int>& blockingObjects,
+		int& rejectedPairs)
+{
+	// Run collision detection for the whole block
+	boost::uint64_t hits = nddlgen::controllers::CollisionDetectionController::doesIntersect(
+			model->getAccessibilityBoundingBox(),
+			block,
+			rejectedPairs
+	);
+
+	// If the bounding boxes intersect, model is blocked by the object in this lane
+	for (int lane = 0; lane < block.getCount(); lane++)
+	{
+		if (hits & (((boost::uint64_t) 1) << lane))
+		{
+			blockingObjects.push_back(blockModels[lane]);
+		}
+	}
+
+	block.clear();
+	blockModels.clear();
+}
+
 nddlgen::models::AbstractObjectModelPtr nddlgen::controllers::DomainDescriptionFactory::objectFactory(
-		sdf::ElementPtr element)
+		nddlgen::utilities::SceneRecord::Model& model)
 {
-	std::string elementName = element->GetAttribute("name")->GetAsString();
-	nddlgen::models::AbstractObjectModelPtr instance = this->_objectFactory->fromString(elementName);
+	nddlgen::models::AbstractObjectModelPtr instance = this->_objectFactory->fromString(model.name);
 
 	// If instance is set
 	if (instance)
 	{
 		// Set name
-		instance->setName(elementName);
-
-		std::string basePoseRaw = element->GetElement("pose")->GetValue()->GetAsString();
-
-		sdf::ElementPtr boundingBox = element->GetElement("link");
+		instance->setName(model.name);
 
-		while (boundingBox)
+		foreach (nddlgen::utilities::SceneRecord::Link& link, model.links)
 		{
-			std::string linkName = boundingBox->GetAttribute("name")->GetAsString();
-
-			if (linkName.find("bounding_box") != std::string::npos)
+			if (link.name.find("bounding_box") != std::string::npos)
 			{
-				std::string poseRaw = boundingBox->GetElement("visual")->GetElement("pose")
-						->GetValue()->GetAsString();
-				std::string sizeRaw = boundingBox->GetElement("visual")->GetElement("geometry")->GetElement("box")
-						->GetElement("size")->GetValue()->GetAsString();
+				// Keep the bounding box in the scene record, so a cached record does not need
+				// to build it again
+				if (!link.boundingBox)
+				{
+					link.boundingBox = nddlgen::controllers::DomainDescriptionFactory::
+							boundingBoxFactory(model.pose, link.visualPose, link.boxSize);
+				}
 
-				nddlgen::math::CuboidPtr boundingBox = nddlgen::controllers::DomainDescriptionFactory::
-						boundingBoxFactory(basePoseRaw, poseRaw, sizeRaw);
+				nddlgen::math::CuboidPtr boundingBox = link.boundingBox;
 
-				if (linkName.find("object") != std::string::npos)
+				if (link.name.find("object") != std::string::npos)
 				{
 					instance->setObjectBoundingBox(boundingBox);
 				}
-				else if (linkName.find("accessibility") != std::string::npos)
+				else if (link.name.find("accessibility") != std::string::npos)
 				{
 					instance->setAccessibilityBoundingBox(boundingBox);
 				}
 			}
-
-			// Iterate
-			boundingBox = boundingBox->GetNextElement("link");
 		}
 	}
 
@@ -392,104 +633,60 @@ nddlgen::models::AbstractObjectModelPtr nddlgen::controllers::DomainDescriptionF
 }
 
 nddlgen::math::CuboidPtr nddlgen::controllers::DomainDescriptionFactory::boundingBoxFactory(
-		std::string basePose,
-		std::string pose,
-		std::string size)
+		const std::string& basePose,
+		const std::string& pose,
+		const std::string& size)
 {
 	// For all values: (x,y,z) element of double^3 (no unit defined by gazebo)
 	//				   (roll,pitch,yaw) element of double^3 (in radians)
 
-	// Vectors holding exploded strings
-	std::vector<std::string> basePoseSplit;
-	std::vector<std::string> poseSplit;
-	std::vector<std::string> sizeSplit;
+	// Parse values directly from the strings
+	double basePoseValues[6];
+	double poseValues[6];
+	double sizeValues[3];
 
-	// Explode strings and save to vectors defined above
-	boost::algorithm::split(basePoseSplit, basePose, boost::is_any_of(" "));
-	boost::algorithm::split(poseSplit, pose, boost::is_any_of(" "));
-	boost::algorithm::split(sizeSplit, size, boost::is_any_of(" "));
+	nddlgen::utilities::NumericTupleParser::parse(basePose, basePoseValues, 6);
+	nddlgen::utilities::NumericTupleParser::parse(pose, poseValues, 6);
+	nddlgen::utilities::NumericTupleParser::parse(size, sizeValues, 3);
 
 	// Extract pose of base object
-	double xBase = atof(basePoseSplit[0].c_str());
-	double yBase = atof(basePoseSplit[1].c_str());
-	double zBase = atof(basePoseSplit[2].c_str());
-	double rollBase = atof(basePoseSplit[3].c_str());
-	double pitchBase = atof(basePoseSplit[4].c_str());
-	double yawBase = atof(basePoseSplit[5].c_str());
+	double xBase = basePoseValues[0];
+	double yBase = basePoseValues[1];
+	double zBase = basePoseValues[2];
+	double rollBase = basePoseValues[3];
+	double pitchBase = basePoseValues[4];
+	double yawBase = basePoseValues[5];
 
 	// Extract pose of bounding box and add base pose
-	double x = atof(poseSplit[0].c_str()) + xBase;
-	double y = atof(poseSplit[1].c_str()) + yBase;
-	double z = atof(poseSplit[2].c_str()) + zBase;
-	double roll = atof(poseSplit[3].c_str());
-	double pitch = atof(poseSplit[4].c_str());
-	double yaw = atof(poseSplit[5].c_str());
+	double x = poseValues[0] + xBase;
+	double y = poseValues[1] + yBase;
+	double z = poseValues[2] + zBase;
+	double roll = poseValues[3];
+	double pitch = poseValues[4];
+	double yaw = poseValues[5];
 
 	// Extract extend of bounding box (an extend is the abs value of half the size)
-	double xExtend = atof(sizeSplit[0].c_str()) / 2.f;
-	double yExtend = atof(sizeSplit[1].c_str()) / 2.f;
-	double zExtend = atof(sizeSplit[2].c_str()) / 2.f;
-
-	// Construct vectors defining every single vertex of the cuboid by extends with the
-	// origin in the middle of the cuboid. This eases rotations
-	nddlgen::math::VectorPtr vertex1(new nddlgen::math::Vector(  xExtend,   yExtend,   zExtend));
-	nddlgen::math::VectorPtr vertex2(new nddlgen::math::Vector(  xExtend, - yExtend,   zExtend));
-	nddlgen::math::VectorPtr vertex3(new nddlgen::math::Vector(- xExtend,   yExtend,   zExtend));
-	nddlgen::math::VectorPtr vertex4(new nddlgen::math::Vector(- xExtend, - yExtend,   zExtend));
-	nddlgen::math::VectorPtr vertex5(new nddlgen::math::Vector(  xExtend,   yExtend, - zExtend));
-	nddlgen::math::VectorPtr vertex6(new nddlgen::math::Vector(  xExtend, - yExtend, - zExtend));
-	nddlgen::math::VectorPtr vertex7(new nddlgen::math::Vector(- xExtend,   yExtend, - zExtend));
-	nddlgen::math::VectorPtr vertex8(new nddlgen::math::Vector(- xExtend, - yExtend, - zExtend));
-
-	// Define and construct vector of all vertices
-	std::vector<nddlgen::math::VectorPtr> vertices;
-	vertices.push_back(vertex1);
-	vertices.push_back(vertex2);
-	vertices.push_back(vertex3);
-	vertices.push_back(vertex4);
-	vertices.push_back(vertex5);
-	vertices.push_back(vertex6);
-	vertices.push_back(vertex7);
-	vertices.push_back(vertex8);
-
-	// Roll cuboid
-	nddlgen::math::CuboidOperations::roll(vertices, rollBase);
-	nddlgen::math::CuboidOperations::roll(vertices, roll);
-
-	// Pitch cuboid
-	nddlgen::math::CuboidOperations::pitch(vertices, pitchBase);
-	nddlgen::math::CuboidOperations::pitch(vertices, pitch);
-
-	// Yaw cuboid
-	nddlgen::math::CuboidOperations::yaw(vertices, yawBase);
-	nddlgen::math::CuboidOperations::yaw(vertices, yaw);
-
-	// Define absolute position of cuboid in space
-	for (int i = 0; i < 8 /* amount of vertices of a cuboid */; i++)
-	{
-		nddlgen::math::VectorPtr vertex = vertices[i];
-
-		vertex->addX(x);
-		vertex->addY(y);
-		vertex->addZ(z);
-	}
-
-	// Calculate normals for each axis
-	nddlgen::math::VectorPtr xAxisNormal = nddlgen::math::VectorOperations::crossProduct(
-			nddlgen::math::VectorOperations::minus(vertex1, vertex5),
-			nddlgen::math::VectorOperations::minus(vertex6, vertex5)
-	);
-	nddlgen::math::VectorPtr yAxisNormal = nddlgen::math::VectorOperations::crossProduct(
-			nddlgen::math::VectorOperations::minus(vertex1, vertex5),
-			nddlgen::math::VectorOperations::minus(vertex7, vertex5)
-	);
-	nddlgen::math::VectorPtr zAxisNormal = nddlgen::math::VectorOperations::crossProduct(
-			nddlgen::math::VectorOperations::minus(vertex7, vertex5),
-			nddlgen::math::VectorOperations::minus(vertex6, vertex5)
-	);
-
-	// Construct cuboid defining the bounding box
-	nddlgen::math::CuboidPtr boundingBox(new nddlgen::math::Cuboid(vertices, xAxisNormal, yAxisNormal, zAxisNormal));
+	double xExtend = sizeValues[0] / 2.f;
+	double yExtend = sizeValues[1] / 2.f;
+	double zExtend = sizeValues[2] / 2.f;
+
+	// Compose base pose and pose to a single rotation. Its columns are the rotated unit vectors
+	// of the cuboid's local axes
+	nddlgen::math::RotationMatrix rotation = nddlgen::math::RotationMatrix::compose(
+			rollBase, pitchBase, yawBase, roll, pitch, yaw);
+
+	nddlgen::math::Vector3 axes[3] = {
+			rotation.getColumn(0),
+			rotation.getColumn(1),
+			rotation.getColumn(2)
+	};
+
+	// Define absolute position and extends of cuboid in space
+	nddlgen::math::Vector3 center = { x, y, z };
+	nddlgen::math::Vector3 halfExtents = { xExtend, yExtend, zExtend };
+
+	// Construct cuboid defining the bounding box. Its vertices are only computed if needed
+	nddlgen::math::CuboidPtr boundingBox(new nddlgen::math::Cuboid(center, halfExtents, axes));
 
 	return boundingBox;
 }
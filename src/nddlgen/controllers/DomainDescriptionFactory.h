@@ -25,12 +25,19 @@
 
 #include <boost/shared_ptr.hpp>
 #include <nddlgen/controllers/AbstractObjectFactory.h>
+#include <nddlgen/controllers/CollisionDetectionController.h>
+#include <nddlgen/controllers/CollisionState.h>
 #include <nddlgen/exceptions/ObjectFactoryNotSetException.hpp>
 #include <sdf/sdf.hh>
 #include <tinyxml.h>
 
+#include <nddlgen/math/AbstractBroadPhase.h>
+#include <nddlgen/math/AxisAlignedBoundingBox.h>
+#include <nddlgen/math/BruteForceBroadPhase.h>
 #include <nddlgen/math/Cuboid.h>
+#include <nddlgen/math/CuboidBlock.h>
 #include <nddlgen/math/CuboidOperations.h>
+#include <nddlgen/math/RotationMatrix.h>
 #include <nddlgen/math/Vector.h>
 #include <nddlgen/math/VectorOperations.h>
 #include <nddlgen/models/AbstractObjectModel.h>
@@ -39,6 +46,9 @@
 #include <nddlgen/models/DomainDescriptionModel.h>
 #include <nddlgen/models/InitialStateFactModel.h>
 #include <nddlgen/models/InitialStateGoalModel.h>
+#include <nddlgen/utilities/NumericTupleParser.h>
+#include <nddlgen/utilities/SceneRecord.h>
+#include <nddlgen/utilities/ThreadPool.h>
 #include <nddlgen/utilities/Types.hpp>
 #include <nddlgen/utilities/Foreach.hpp>
 
@@ -66,6 +76,34 @@ class nddlgen::controllers::DomainDescriptionFactory
 		 */
 		nddlgen::controllers::AbstractObjectFactoryPtr _objectFactory;
 
+		/**
+		 * Broad phase used to prune pairs of bounding boxes before running the collision detection.
+		 */
+		nddlgen::math::AbstractBroadPhasePtr _broadPhase;
+
+		/**
+		 * Thread pool used to run the collision detection in parallel.
+		 */
+		nddlgen::utilities::ThreadPoolPtr _threadPool;
+
+		/**
+		 * Persistent collision state for incremental updates. Null, if every build should
+		 * compute all blocking relations from scratch.
+		 */
+		nddlgen::controllers::CollisionStatePtr _collisionState;
+
+		/**
+		 * Amount of pairs tested by the collision detection during the last build or update,
+		 * and amount of them rejected by comparing their axis aligned bounds.
+		 */
+		boost::uint64_t _testedPairs;
+		boost::uint64_t _rejectedPairs;
+
+		/**
+		 * Flag to instantiate the models of the SDF on the thread pool.
+		 */
+		bool _parallelObjectCreation;
+
 		/**
 		 * Collection of all NddlGeneratable objects within the hierarchy.
 		 * Access this only with the getObjects() function, since this value
@@ -75,24 +113,26 @@ class nddlgen::controllers::DomainDescriptionFactory
 
 		/**
 		 * Populates domain description model with the models that are found in the SDF.
+		 * If parallel object creation is enabled, the models are instantiated on the thread
+		 * pool first. They are added to the workspace in document order either way.
 		 *
 		 * @param domainDescription Domain description model
-		 * @param sdfRoot SDF document root
+		 * @param scene Scene record of the SDF
 		 */
 		void populateWithObjectsFromSdf(
 				nddlgen::models::DomainDescriptionModelPtr domainDescription,
-				nddlgen::types::SdfRoot sdfRoot
+				nddlgen::utilities::SceneRecordPtr scene
 		);
 
 		/**
 		 * Populates domain description model with the goals from the ISD.
 		 *
 		 * @param domainDescription Domain description model
-		 * @param isdRoot ISD document root
+		 * @param scene Scene record holding the goals of the ISD
 		 */
 		void populateWithGoalsFromIsd(
 				nddlgen::models::DomainDescriptionModelPtr domainDescription,
-				nddlgen::types::IsdRoot isdRoot
+				nddlgen::utilities::SceneRecordPtr scene
 		);
 
 		/**
@@ -128,6 +168,10 @@ class nddlgen::controllers::DomainDescriptionFactory
 		/**
 		 * Populates the models within the domain description model which are
 		 * blocked by other objects according to a collision detection algorithm.
+		 * Only pairs reported by the broad phase are handed to the collision detection.
+		 * If a collision state is set, it is updated instead, so only objects which changed
+		 * since its last update are tested again. The blocking matrix of the domain description
+		 * model is filled as well.
 		 *
 		 * @param domainDescription Domain description model
 		 */
@@ -154,6 +198,21 @@ class nddlgen::controllers::DomainDescriptionFactory
 				nddlgen::models::DomainDescriptionModelPtr domainDescription
 		);
 
+		/**
+		 * Helper to instantiate one model of the SDF. Only touches the given model and
+		 * instance, so it can be run for several models concurrently.
+		 *
+		 * @param index Index of the model
+		 * @param models Models of the scene record
+		 * @param instances Receives the instantiated NddlGeneratable of each model, or a null
+		 * pointer if it is not supported
+		 */
+		void objectPopulationHelper(
+				int index,
+				std::vector<nddlgen::utilities::SceneRecord::Model>& models,
+				std::vector<nddlgen::models::AbstractObjectModelPtr>& instances
+		);
+
 		/**
 		 * Helper to populate models with sub objects as defined in the initSubObjects()
 		 * function.
@@ -187,15 +246,68 @@ class nddlgen::controllers::DomainDescriptionFactory
 		);
 
 		/**
-		 * Factory function to instantiate NddGeneratables.
+		 * Helper to update the collision state with the bounding boxes of the given models.
+		 *
+		 * @param models All models on the workspace
+		 */
+		void collisionStateUpdateHelper(
+				const nddlgen::types::ObjectModelList& models
+		);
+
+		/**
+		 * Helper to run collision detection between the accessibility bounding box of one model
+		 * and the object bounding boxes of its candidates. Does not modify any model, so it
+		 * can be run for several models concurrently.
+		 *
+		 * @param index Index within accessibilityModels
+		 * @param models All models on the workspace
+		 * @param accessibilityModels Ids of the models having an accessibility bounding box
+		 * @param candidates Ids of the candidates of each model as reported by the broad phase
+		 * @param blockingObjects Receives the ids of the blocking objects of each model, in
+		 * candidate order
+		 * @param testedPairs Receives the amount of tested pairs of each model
+		 * @param rejectedPairs Receives the amount of pairs of each model rejected by their bounds
+		 */
+		void blockedObjectsPopulationHelper(
+				int index,
+				const nddlgen::types::ObjectModelList& models,
+				const std::vector<int>& accessibilityModels,
+				const std::vector<std::vector<int> >& candidates,
+				std::vector<std::vector<int> >& blockingObjects,
+				std::vector<int>& testedPairs,
+				std::vector<int>& rejectedPairs
+		);
+
+		/**
+		 * Helper to run collision detection between the accessibility bounding box of a model
+		 * and a block of object bounding boxes. Blocking objects are appended in lane order. The
+		 * block and the lane mapping are cleared afterwards.
+		 *
+		 * @param model Model whose accessibility bounding box is tested
+		 * @param block Block of object bounding boxes
+		 * @param blockModels Ids of the models the boxes in block belong to, indexed by lane
+		 * @param blockingObjects Receives the ids of the blocking objects
+		 * @param rejectedPairs Incremented by the amount of pairs rejected by their bounds
+		 */
+		void blockedObjectsBlockHelper(
+				nddlgen::models::AbstractObjectModelPtr model,
+				nddlgen::math::CuboidBlock& block,
+				std::vector<int>& blockModels,
+				std::vector<int>& blockingObjects,
+				int& rejectedPairs
+		);
+
+		/**
+		 * Factory function to instantiate NddGeneratables. Bounding boxes are only built for
+		 * links of the model which have none yet, and are stored in the link afterwards.
 		 *
-		 * @param element SDF element node
+		 * @param model SDF model as found in the scene record
 		 *
 		 * @return Instantiated NddlGeneratable, or null pointer if this->_modelFactory was
 		 * not able to instantiate one from the SDF data.
 		 */
 		nddlgen::models::AbstractObjectModelPtr objectFactory(
-				sdf::ElementPtr element
+				nddlgen::utilities::SceneRecord::Model& model
 		);
 
 		/**
@@ -206,11 +318,14 @@ class nddlgen::controllers::DomainDescriptionFactory
 		 * @param size Size as defined in SDF
 		 *
 		 * @return Cuboid object representing bounding box.
+		 *
+		 * @throws MalformedNumericTupleException if a pose does not consist of 6 numbers or
+		 * the size does not consist of 3 numbers.
 		 */
 		nddlgen::math::CuboidPtr boundingBoxFactory(
-				std::string basePose,
-				std::string pose,
-				std::string size
+				const std::string& basePose,
+				const std::string& pose,
+				const std::string& size
 		);
 
 		/**
@@ -252,7 +367,7 @@ class nddlgen::controllers::DomainDescriptionFactory
 		 * Builds a domain description out of SDF and ISD document roots.
 		 *
 		 * @param sdfRoot SDF document root
-		 * @param isdRoot ISD document root
+		 * @param isdRoot ISD document root, or null if there is no ISD
 		 *
 		 * @return Fully qualified domain description model.
 		 */
@@ -261,6 +376,18 @@ class nddlgen::controllers::DomainDescriptionFactory
 				nddlgen::types::IsdRoot isdRoot
 		);
 
+		/**
+		 * Builds a domain description out of a scene record holding the SDF world and the
+		 * goals of the ISD. Bounding boxes built along the way are stored in the scene record.
+		 *
+		 * @param scene Scene record
+		 *
+		 * @return Fully qualified domain description model.
+		 */
+		nddlgen::models::DomainDescriptionModelPtr build(
+				nddlgen::utilities::SceneRecordPtr scene
+		);
+
 		/**
 		 * Set model factory needed by domain description factory.
 		 *
@@ -270,6 +397,81 @@ class nddlgen::controllers::DomainDescriptionFactory
 				nddlgen::controllers::AbstractObjectFactoryPtr modelFactory
 		);
 
+		/**
+		 * Set broad phase used to prune collision candidates. Defaults to a brute force
+		 * broad phase testing all permutations.
+		 *
+		 * @param broadPhase Broad phase
+		 */
+		void setBroadPhase(
+				nddlgen::math::AbstractBroadPhasePtr broadPhase
+		);
+
+		/**
+		 * Set thread pool used to run the collision detection in parallel. Defaults to a
+		 * pool with a single thread, which runs everything serially. The result does not
+		 * depend on the amount of threads.
+		 *
+		 * @param threadPool Thread pool
+		 */
+		void setThreadPool(
+				nddlgen::utilities::ThreadPoolPtr threadPool
+		);
+
+		/**
+		 * Set whether the models of the SDF are instantiated on the thread pool, including
+		 * matching them against the model factory and building their bounding boxes. The
+		 * model factory and the models it creates must support being instantiated
+		 * concurrently. The result does not depend on this setting, but if several models
+		 * are malformed, the exception thrown may belong to any of them. Disabled by default.
+		 *
+		 * @param parallelObjectCreation True to instantiate models in parallel, false if not
+		 */
+		void setParallelObjectCreation(
+				bool parallelObjectCreation
+		);
+
+		/**
+		 * Set persistent collision state. If set, building a domain description only tests
+		 * objects whose bounding boxes changed since the state was last updated. The same
+		 * state can be passed to factories of subsequent builds.
+		 *
+		 * @param collisionState Collision state
+		 */
+		void setCollisionState(
+				nddlgen::controllers::CollisionStatePtr collisionState
+		);
+
+		/**
+		 * Updates the blocking objects of an already built domain description model after
+		 * bounding boxes of its models were changed. Only pairs involving changed models are
+		 * tested again, and only the blocking objects of affected models are replaced, both
+		 * within the models and the blocking matrix. If no collision state was set, a new one
+		 * is created.
+		 *
+		 * @param domainDescription Domain description model
+		 */
+		void updateBlockedObjects(
+				nddlgen::models::DomainDescriptionModelPtr domainDescription
+		);
+
+		/**
+		 * Gets the amount of pairs of bounding boxes tested by the collision detection during
+		 * the last build or update.
+		 *
+		 * @return Amount of tested pairs.
+		 */
+		boost::uint64_t getTestedPairs();
+
+		/**
+		 * Gets the amount of tested pairs which were rejected by comparing their axis aligned
+		 * bounds, without running the separating axis test. Pairs pruned by the broad phase
+		 * are not tested at all, so they are not counted either.
+		 *
+		 * @return Amount of rejected pairs.
+		 */
+		boost::uint64_t getRejectedPairs();
+
 };
 
 #endif
@@ -35,8 +35,25 @@ nddlgen::types::IsdRoot nddlgen::controllers::IsdParser::parseIsd()
 	// Local variable initializations
 	nddlgen::types::IsdRoot doc(new TiXmlDocument());
 
-	// Try to read the file and parse ISD
-	if (!doc->LoadFile(this->_config->getIsdInputFile()))
+	// Map the file into memory, so it is parsed without copying it first
+	nddlgen::utilities::MappedFile file(this->_config->getIsdInputFile());
+
+	// Name the document after the file, like TiXmlDocument::LoadFile() does
+	doc->SetValue(this->_config->getIsdInputFile().c_str());
+
+	// Try to parse ISD. Line endings are only normalized (and the file thereby copied) if it
+	// contains carriage returns, so it is parsed the same way as by TiXmlDocument::LoadFile()
+	if (std::memchr(file.getData(), '\r', file.getSize()))
+	{
+		std::string normalized = IsdParser::lineEndingNormalizationHelper(file.getData(), file.getSize());
+		doc->Parse(normalized.c_str(), 0, TIXML_DEFAULT_ENCODING);
+	}
+	else
+	{
+		doc->Parse(file.getData(), 0, TIXML_DEFAULT_ENCODING);
+	}
+
+	if (doc->Error())
 	{
 		throw nddlgen::exceptions::ReadingIsdFileException();
 	}
@@ -65,3 +82,29 @@ void nddlgen::controllers::IsdParser::checkAssertions()
 		throw nddlgen::exceptions::FileDoesNotExistException(this->_config->getIsdInputFile());
 	}
 }
+
+std::string nddlgen::controllers::IsdParser::lineEndingNormalizationHelper(const char* data, std::size_t size)
+{
+	std::string normalized;
+	normalized.reserve(size);
+
+	for (std::size_t i = 0; i < size; i++)
+	{
+		if (data[i] != '\r')
+		{
+			normalized.push_back(data[i]);
+		}
+		else
+		{
+			// CR LF and single CR both become LF
+			normalized.push_back('\n');
+
+			if (i + 1 < size && data[i + 1] == '\n')
+			{
+				i++;
+			}
+		}
+	}
+
+	return normalized;
+}
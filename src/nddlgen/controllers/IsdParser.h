@@ -17,6 +17,10 @@
 #ifndef NDDLGEN_CONTROLLER_ISDPARSER_H_
 #define NDDLGEN_CONTROLLER_ISDPARSER_H_
 
+#include <cstddef>
+#include <cstring>
+#include <string>
+
 #include <boost/shared_ptr.hpp>
 #include <tinyxml.h>
 
@@ -24,6 +28,7 @@
 #include <nddlgen/exceptions/IsdInputFileNotSetException.hpp>
 #include <nddlgen/exceptions/FileMustBeIsdException.hpp>
 #include <nddlgen/exceptions/FileDoesNotExistException.hpp>
+#include <nddlgen/utilities/MappedFile.h>
 #include <nddlgen/utilities/WorkflowControllerConfig.h>
 #include <nddlgen/utilities/Types.hpp>
 
@@ -56,6 +61,17 @@ class nddlgen::controllers::IsdParser
 		 */
 		void checkAssertions();
 
+		/**
+		 * Helper to convert CR LF and single CR line endings to LF, like TinyXML does when
+		 * loading a file.
+		 *
+		 * @param data First character
+		 * @param size Amount of characters
+		 *
+		 * @return Text with LF line endings only.
+		 */
+		static std::string lineEndingNormalizationHelper(const char* data, std::size_t size);
+
 	public:
 
 		/**
@@ -16,6 +16,12 @@
 
 #include <nddlgen/controllers/NddlGenerationController.h>
 
+namespace
+{
+	const std::string CREATION_DATE_PREFIX = "// Creation date: ";
+	const std::string CONTENT_HASH_PREFIX = "// Content hash: ";
+}
+
 nddlgen::controllers::NddlGenerationController::NddlGenerationController()
 {
 
@@ -31,29 +37,30 @@ void nddlgen::controllers::NddlGenerationController::writeModelFile(
 		nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig,
 		bool forceOverwrite)
 {
-	// Assert that the file does not exist yet, unless an overwrite is forced
-	if (!forceOverwrite && boost::filesystem::exists(controllerConfig->getOutputModelFile()))
+	// Assert that the file does not exist yet, unless an overwrite is forced. In incremental
+	// mode, this is checked after comparing the content, since unchanged files may exist
+	if (!controllerConfig->isIncrementalOutput() && !forceOverwrite
+			&& boost::filesystem::exists(controllerConfig->getOutputModelFile()))
 	{
 		throw nddlgen::exceptions::FileAlreadyExistsException(controllerConfig->getOutputModelFile());
 	}
 
-	// Open output file stream
-	std::ofstream ofStream(controllerConfig->getOutputModelFile());
-
-	// Print boilerplate
-	nddlgen::controllers::NddlGenerationController::generateModelBoilerplate(ofStream, controllerConfig);
+	// In incremental or atomic mode, generate in memory first
+	if (controllerConfig->isIncrementalOutput() || controllerConfig->isAtomicOutput())
+	{
+		nddlgen::utilities::MemoryOutputSink memoryOutputSink;
+		nddlgen::controllers::NddlGenerationController::generateModel(domainDescription, controllerConfig, memoryOutputSink);
 
-	// Print forward declarations
-	domainDescription->generateForwardDeclarations(ofStream);
+		nddlgen::controllers::NddlGenerationController::contentWritingHelper(
+				controllerConfig->getOutputModelFile(), memoryOutputSink.getData(), controllerConfig, forceOverwrite);
 
-	// Print model for each used class
-	domainDescription->generateNddlClasses(ofStream);
+		return;
+	}
 
-	// Print arm actions
-	domainDescription->generateActions(ofStream);
+	// Open output sink, which writes the file in large blocks
+	nddlgen::utilities::FileOutputSink outputSink(controllerConfig->getOutputModelFile());
 
-	// Model file generated, close stream
-	ofStream.close();
+	nddlgen::controllers::NddlGenerationController::generateModel(domainDescription, controllerConfig, outputSink);
 }
 
 void nddlgen::controllers::NddlGenerationController::writeInitialStateFile(
@@ -61,50 +68,93 @@ void nddlgen::controllers::NddlGenerationController::writeInitialStateFile(
 		nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig,
 		bool forceOverwrite)
 {
-	// Assert that the file does not exist yet, unless an overwrite is forced
-	if (!forceOverwrite && boost::filesystem::exists(controllerConfig->getOutputInitialStateFile()))
+	// Assert that the file does not exist yet, unless an overwrite is forced. In incremental
+	// mode, this is checked after comparing the content, since unchanged files may exist
+	if (!controllerConfig->isIncrementalOutput() && !forceOverwrite
+			&& boost::filesystem::exists(controllerConfig->getOutputInitialStateFile()))
 	{
 		throw nddlgen::exceptions::FileAlreadyExistsException(controllerConfig->getOutputInitialStateFile());
 	}
 
-	// Open output file stream
-	std::ofstream ofStream(controllerConfig->getOutputInitialStateFile());
+	// In incremental or atomic mode, generate in memory first
+	if (controllerConfig->isIncrementalOutput() || controllerConfig->isAtomicOutput())
+	{
+		nddlgen::utilities::MemoryOutputSink memoryOutputSink;
+		nddlgen::controllers::NddlGenerationController::generateInitialState(domainDescription, controllerConfig, memoryOutputSink);
+
+		nddlgen::controllers::NddlGenerationController::contentWritingHelper(
+				controllerConfig->getOutputInitialStateFile(), memoryOutputSink.getData(), controllerConfig, forceOverwrite);
+
+		return;
+	}
+
+	// Open output sink, which writes the file in large blocks
+	nddlgen::utilities::FileOutputSink outputSink(controllerConfig->getOutputInitialStateFile());
+
+	nddlgen::controllers::NddlGenerationController::generateInitialState(domainDescription, controllerConfig, outputSink);
+}
+
+void nddlgen::controllers::NddlGenerationController::generateModel(
+		nddlgen::models::DomainDescriptionModelPtr domainDescription,
+		nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig,
+		nddlgen::utilities::OutputSink& outputSink)
+{
+	// Print boilerplate
+	nddlgen::controllers::NddlGenerationController::generateModelBoilerplate(outputSink, controllerConfig);
+
+	// Print forward declarations
+	domainDescription->generateForwardDeclarations(outputSink);
+
+	// Print model for each used class
+	domainDescription->generateNddlClasses(outputSink);
+
+	// Print arm actions
+	domainDescription->generateActions(outputSink);
+
+	// Model generated, write remaining text and close sink
+	outputSink.close();
+}
 
+void nddlgen::controllers::NddlGenerationController::generateInitialState(
+		nddlgen::models::DomainDescriptionModelPtr domainDescription,
+		nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig,
+		nddlgen::utilities::OutputSink& outputSink)
+{
 	// Print boilerplate
-	nddlgen::controllers::NddlGenerationController::generateInitialStateBoilerplate(ofStream, controllerConfig);
+	nddlgen::controllers::NddlGenerationController::generateInitialStateBoilerplate(outputSink, controllerConfig);
 
 	// Print include directive for the NDDL model file
-	wrln(0, "#include \"" + controllerConfig->getOutputModelFileName() + "\"", 2);
+	outputSink.writeLine(0, "#include \"" + controllerConfig->getOutputModelFileName() + "\"", 2);
 
 	// Print instantiation of all needed objects
-	domainDescription->generateInstantiations(ofStream);
+	domainDescription->generateInstantiations(outputSink);
 
 	// Print PLASMA function call to close model instantiation
-	wrln(0, "close();", 2);
+	outputSink.writeLine(0, "close();", 2);
 
 	// Print facts
-	domainDescription->generateFacts(ofStream);
+	domainDescription->generateFacts(outputSink);
 
 	// Print goals
-	domainDescription->generateGoals(ofStream);
+	domainDescription->generateGoals(outputSink);
 
-	// Initial state file generated, close stream
-	ofStream.close();
+	// Initial state generated, write remaining text and close sink
+	outputSink.close();
 }
 
-void nddlgen::controllers::NddlGenerationController::generateModelBoilerplate(std::ofstream& ofStream,
+void nddlgen::controllers::NddlGenerationController::generateModelBoilerplate(nddlgen::utilities::OutputSink& outputSink,
 		nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig)
 {
-	nddlgen::controllers::NddlGenerationController::generateBoilerplate(ofStream, controllerConfig, "model");
+	nddlgen::controllers::NddlGenerationController::generateBoilerplate(outputSink, controllerConfig, "model");
 }
 
-void nddlgen::controllers::NddlGenerationController::generateInitialStateBoilerplate(std::ofstream& ofStream,
+void nddlgen::controllers::NddlGenerationController::generateInitialStateBoilerplate(nddlgen::utilities::OutputSink& outputSink,
 		nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig)
 {
-	nddlgen::controllers::NddlGenerationController::generateBoilerplate(ofStream, controllerConfig, "initial state");
+	nddlgen::controllers::NddlGenerationController::generateBoilerplate(outputSink, controllerConfig, "initial state");
 }
 
-void nddlgen::controllers::NddlGenerationController::generateBoilerplate(std::ofstream& ofStream,
+void nddlgen::controllers::NddlGenerationController::generateBoilerplate(nddlgen::utilities::OutputSink& outputSink,
 		nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig,
 		std::string modelOrInitialState)
 {
@@ -138,25 +188,25 @@ void nddlgen::controllers::NddlGenerationController::generateBoilerplate(std::of
 	}
 
 	// Print boilerplate
-	wrln(0, "// Generated by nddlgen \t\t <" + nddlgenProjectHomepage + ">", 1);
-	wrln(0, "// Author: Christian Dreher \t <" + authorChrDreherEmail + ">", 1);
-	wrln(0, "// Support: \t\t\t\t\t <" + nddlgenSupportEmail + ">", 2);
+	outputSink.writeLine(0, "// Generated by nddlgen \t\t <" + nddlgenProjectHomepage + ">", 1);
+	outputSink.writeLine(0, "// Author: Christian Dreher \t <" + authorChrDreherEmail + ">", 1);
+	outputSink.writeLine(0, "// Support: \t\t\t\t\t <" + nddlgenSupportEmail + ">", 2);
 
-	wrln(0, "// This NDDL " + modelOrInitialState + " file (" + outputFile + ") was generated from ", 1);
-	wrln(0, "// \"" + sdfInputFile + "\" originally located in \"" + sdfInputFilePath + "\" ", 0);
+	outputSink.writeLine(0, "// This NDDL " + modelOrInitialState + " file (" + outputFile + ") was generated from ", 1);
+	outputSink.writeLine(0, "// \"" + sdfInputFile + "\" originally located in \"" + sdfInputFilePath + "\" ", 0);
 
 	if (modelOrInitialState == "model")
 	{
-		wrln(0, "by", 1);
+		outputSink.writeLine(0, "by", 1);
 	}
 	else if (modelOrInitialState == "initial state")
 	{
-		wrln(0, "and", 1);
-		wrln(0, "// \"" + isdInputFile + "\" originally located in \"" + isdInputFilePath + "\" by", 1);
+		outputSink.writeLine(0, "and", 1);
+		outputSink.writeLine(0, "// \"" + isdInputFile + "\" originally located in \"" + isdInputFilePath + "\" by", 1);
 	}
 
-	wrln(0, "// nddlgen-core v" + nddlgenVersion + " using " + adapter + "", 1);
-	wrln(0, "// Creation date: " + now, 2);
+	outputSink.writeLine(0, "// nddlgen-core v" + nddlgenVersion + " using " + adapter + "", 1);
+	outputSink.writeLine(0, CREATION_DATE_PREFIX + now, 2);
 }
 
 std::string nddlgen::controllers::NddlGenerationController::getPrettifiedDate()
@@ -170,3 +220,89 @@ std::string nddlgen::controllers::NddlGenerationController::getPrettifiedDate()
 	// Return prettified date
 	return date;
 }
+
+void nddlgen::controllers::NddlGenerationController::contentWritingHelper(std::string fileName,
+		const std::string& content, nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig,
+		bool forceOverwrite)
+{
+	// The content hash line, if any, is written between the content before and after this position
+	std::string::size_type splitPosition = 0;
+	std::string contentHashLine = "";
+
+	if (controllerConfig->isIncrementalOutput())
+	{
+		// Hash everything but the creation date line
+		std::string::size_type dateBegin = content.find(CREATION_DATE_PREFIX);
+		std::string::size_type dateEnd = content.find('\n', dateBegin);
+
+		if (dateBegin == std::string::npos || dateEnd == std::string::npos)
+		{
+			dateBegin = dateEnd = 0;
+		}
+		else
+		{
+			dateEnd++;
+		}
+
+		nddlgen::utilities::ContentHash hash;
+		hash.update(content.data(), dateBegin);
+		hash.update(content.data() + dateEnd, content.size() - dateEnd);
+
+		// Add hash to the boilerplate, right after the creation date
+		std::string contentHash = hash.toString();
+		contentHashLine = CONTENT_HASH_PREFIX + contentHash + "\n";
+		splitPosition = dateEnd;
+
+		// Leave the file untouched if it holds the same content already
+		boost::system::error_code error;
+		boost::uintmax_t fileSize = boost::filesystem::file_size(fileName, error);
+
+		if (!error && fileSize == content.size() + contentHashLine.size()
+				&& nddlgen::controllers::NddlGenerationController::contentHashReadingHelper(fileName) == contentHash)
+		{
+			return;
+		}
+
+		// Changed content may only replace an existing file if an overwrite is forced
+		if (!forceOverwrite && boost::filesystem::exists(fileName))
+		{
+			throw nddlgen::exceptions::FileAlreadyExistsException(fileName);
+		}
+	}
+
+	if (controllerConfig->isAtomicOutput())
+	{
+		// Replace the file at once, without copying the content
+		nddlgen::utilities::AtomicFileWriter writer(fileName);
+		writer.append(content.data(), splitPosition);
+		writer.append(contentHashLine);
+		writer.append(content.data() + splitPosition, content.size() - splitPosition);
+		writer.commit(controllerConfig->isSynchronousOutput());
+	}
+	else
+	{
+		// Write the ranges in place, the sink only buffers a block at a time
+		nddlgen::utilities::FileOutputSink outputSink(fileName);
+		outputSink.write(content.data(), splitPosition);
+		outputSink.write(contentHashLine);
+		outputSink.write(content.data() + splitPosition, content.size() - splitPosition);
+		outputSink.close();
+	}
+}
+
+std::string nddlgen::controllers::NddlGenerationController::contentHashReadingHelper(std::string fileName)
+{
+	std::ifstream file(fileName.c_str());
+	std::string line;
+
+	// Only search the boilerplate, which consists of comment lines
+	while (std::getline(file, line) && boost::starts_with(line, "//"))
+	{
+		if (boost::starts_with(line, CONTENT_HASH_PREFIX))
+		{
+			return line.substr(CONTENT_HASH_PREFIX.length());
+		}
+	}
+
+	return "";
+}
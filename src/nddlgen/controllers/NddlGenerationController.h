@@ -23,6 +23,7 @@
 #include <list>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/shared_ptr.hpp>
 
@@ -30,9 +31,14 @@
 #include <nddlgen/models/AbstractObjectModel.h>
 #include <nddlgen/models/DomainDescriptionModel.h>
 #include <nddlgen/models/ProcessModel.h>
+#include <nddlgen/utilities/AtomicFileWriter.h>
+#include <nddlgen/utilities/ContentHash.h>
 #include <nddlgen/utilities/Foreach.hpp>
 #include <nddlgen/utilities/Types.hpp>
 #include <nddlgen/utilities/Meta.h>
+#include <nddlgen/utilities/FileOutputSink.h>
+#include <nddlgen/utilities/MemoryOutputSink.h>
+#include <nddlgen/utilities/OutputSink.h>
 #include <nddlgen/utilities/WorkflowControllerConfig.h>
 
 namespace nddlgen
@@ -67,27 +73,27 @@ class nddlgen::controllers::NddlGenerationController
 		/**
 		 * Generates an nddlgen model file boilerplate.
 		 *
-		 * @param ofStream Output file stream
+		 * @param outputSink Output sink
 		 * @param controllerConfig Workflow controller configuration
 		 */
-		static void generateModelBoilerplate(std::ofstream& ofStream, nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig);
+		static void generateModelBoilerplate(nddlgen::utilities::OutputSink& outputSink, nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig);
 
 		/**
 		 * Generates an nddlgen initial state file boilerplate.
 		 *
-		 * @param ofStream Output file stream
+		 * @param outputSink Output sink
 		 * @param controllerConfig Workflow controller configuration
 		 */
-		static void generateInitialStateBoilerplate(std::ofstream& ofStream, nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig);
+		static void generateInitialStateBoilerplate(nddlgen::utilities::OutputSink& outputSink, nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig);
 
 		/**
 		 * Generic function to generate boilerplate.
 		 *
-		 * @param ofStream Output file stream
+		 * @param outputSink Output sink
 		 * @param controllerConfig Workflow controller configuration
 		 * @param modelOrInitialState Either "model" or "initial state", according to desired boiler plate
 		 */
-		static void generateBoilerplate(std::ofstream& ofStream, nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig, std::string modelOrInitialState);
+		static void generateBoilerplate(nddlgen::utilities::OutputSink& outputSink, nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig, std::string modelOrInitialState);
 
 		/**
 		 * Gets timestamp and prettifies it.
@@ -96,6 +102,33 @@ class nddlgen::controllers::NddlGenerationController
 		 */
 		static std::string getPrettifiedDate();
 
+		/**
+		 * Helper to write content generated in memory to a file. In incremental output mode,
+		 * the content is hashed without its creation date line, and the hash is added to the
+		 * boilerplate right after that line. The file is then left untouched if it carries
+		 * the same hash and has the same size, even if an overwrite is not forced. In atomic
+		 * output mode, the file is replaced by renaming a temporary file.
+		 *
+		 * @param fileName Output file
+		 * @param content Generated content, including boilerplate
+		 * @param controllerConfig Workflow controller configuration
+		 * @param forceOverwrite Flag to indicate, how already existing files should be handled
+		 *
+		 * @throws FileAlreadyExistsException if the content changed, but the file may not be overwritten.
+		 * @throws WritingOutputFileException if the file can not be written.
+		 */
+		static void contentWritingHelper(std::string fileName, const std::string& content,
+				nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig, bool forceOverwrite);
+
+		/**
+		 * Helper to read the content hash from the boilerplate of a previously generated file.
+		 *
+		 * @param fileName Output file
+		 *
+		 * @return Content hash, or an empty string if the file has none or can not be read.
+		 */
+		static std::string contentHashReadingHelper(std::string fileName);
+
 	public:
 
 		/**
@@ -104,6 +137,11 @@ class nddlgen::controllers::NddlGenerationController
 		 * @param domainDescription Domain description model
 		 * @param controllerConfig Workflow controller configuration
 		 * @param forceOverwrite Flag to indicate, how already existing files should be handled
+		 *
+		 * @throws WritingOutputFileException if the file can not be written.
+		 *
+		 * @see WorkflowControllerConfig::setIncrementalOutput()
+		 * @see WorkflowControllerConfig::setAtomicOutput()
 		 */
 		static void writeModelFile(nddlgen::models::DomainDescriptionModelPtr domainDescription,
 				nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig,
@@ -115,11 +153,38 @@ class nddlgen::controllers::NddlGenerationController
 		 * @param domainDescription Domain description model
 		 * @param controllerConfig Workflow controller configuration
 		 * @param forceOverwrite Flag to indicate, how already existing files should be handled
+		 *
+		 * @throws WritingOutputFileException if the file can not be written.
+		 *
+		 * @see WorkflowControllerConfig::setIncrementalOutput()
+		 * @see WorkflowControllerConfig::setAtomicOutput()
 		 */
 		static void writeInitialStateFile(nddlgen::models::DomainDescriptionModelPtr domainDescription,
 				nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig,
 				bool forceOverwrite);
 
+		/**
+		 * Generates NDDL model into an output sink, which is closed afterwards.
+		 *
+		 * @param domainDescription Domain description model
+		 * @param controllerConfig Workflow controller configuration
+		 * @param outputSink Output sink
+		 */
+		static void generateModel(nddlgen::models::DomainDescriptionModelPtr domainDescription,
+				nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig,
+				nddlgen::utilities::OutputSink& outputSink);
+
+		/**
+		 * Generates NDDL initial state into an output sink, which is closed afterwards.
+		 *
+		 * @param domainDescription Domain description model
+		 * @param controllerConfig Workflow controller configuration
+		 * @param outputSink Output sink
+		 */
+		static void generateInitialState(nddlgen::models::DomainDescriptionModelPtr domainDescription,
+				nddlgen::utilities::WorkflowControllerConfigPtr controllerConfig,
+				nddlgen::utilities::OutputSink& outputSink);
+
 };
 
 #endif
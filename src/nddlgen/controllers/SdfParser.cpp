@@ -16,6 +16,9 @@
 
 #include <nddlgen/controllers/SdfParser.h>
 
+boost::mutex nddlgen::controllers::SdfParser::_formatDescriptionMutex;
+sdf::ElementPtr nddlgen::controllers::SdfParser::_formatDescription;
+
 nddlgen::controllers::SdfParser::SdfParser(nddlgen::utilities::WorkflowControllerConfigPtr config)
 {
 	// Assign config to member variable
@@ -35,32 +38,50 @@ nddlgen::types::SdfRoot nddlgen::controllers::SdfParser::parseSdf()
 	// Local variable initializations
 	sdf::SDFPtr doc(new sdf::SDF());
 
-	// Disable standard cerr output, since the output of the SDF library can't be suppressed otherwise
-	nddlgen::utilities::StdCerrHandler::disableCerr();
+	// Capture cerr output of this thread, since the output of the SDF library can't be suppressed otherwise
+	nddlgen::utilities::StdCerrCapture cerrCapture;
 
 	// Initialize .sdf based on installed sdf_format.xml file
-	if (!sdf::init(doc))
+	if (!SdfParser::initDocument(doc))
 	{
-		// Re-enable standard cerr
-		nddlgen::utilities::StdCerrHandler::enableCerr();
-		throw nddlgen::exceptions::InitializingSdfException(nddlgen::utilities::StdCerrHandler::getBufferedCerrOutput());
+		throw nddlgen::exceptions::InitializingSdfException(cerrCapture.getOutput());
 	}
 
 	// Try to read the file and parse SDF
 	if (!sdf::readFile(this->_config->getSdfInputFile(), doc))
 	{
-		// Re-enable standard cerr
-		nddlgen::utilities::StdCerrHandler::enableCerr();
-		throw nddlgen::exceptions::ReadingSdfFileException(nddlgen::utilities::StdCerrHandler::getBufferedCerrOutput());
+		throw nddlgen::exceptions::ReadingSdfFileException(cerrCapture.getOutput());
 	}
 
-	// Re-enable standard cerr
-	nddlgen::utilities::StdCerrHandler::enableCerr();
-
 	// Return document
 	return doc;
 }
 
+nddlgen::utilities::SceneRecordPtr nddlgen::controllers::SdfParser::parseScene()
+{
+	if (this->_config->isStreamingSdfParsing())
+	{
+		// Assert that all preconditions are met. Throw exception if not
+		this->checkAssertions();
+
+		// Map the file into memory, so the extractor reads it without copying
+		nddlgen::utilities::MappedFile file(this->_config->getSdfInputFile());
+
+		// Try to extract the scene directly from the file
+		try
+		{
+			nddlgen::controllers::SdfSceneExtractor extractor;
+			return extractor.extract(file.getData(), file.getSize());
+		}
+		catch (const nddlgen::exceptions::UnsupportedSdfException&)
+		{
+			// Fall back to the SDF library below
+		}
+	}
+
+	return nddlgen::utilities::SceneRecord::fromSdf(this->parseSdf());
+}
+
 void nddlgen::controllers::SdfParser::checkAssertions()
 {
 	// Assert that an SDF input file has been set
@@ -81,3 +102,26 @@ void nddlgen::controllers::SdfParser::checkAssertions()
 		throw nddlgen::exceptions::FileDoesNotExistException(this->_config->getSdfInputFile());
 	}
 }
+
+bool nddlgen::controllers::SdfParser::initDocument(sdf::SDFPtr doc)
+{
+	boost::mutex::scoped_lock lock(SdfParser::_formatDescriptionMutex);
+
+	// Load format description on first use. If this fails, the next parse tries again
+	if (!SdfParser::_formatDescription)
+	{
+		sdf::SDFPtr formatDocument(new sdf::SDF());
+
+		if (!sdf::init(formatDocument))
+		{
+			return false;
+		}
+
+		SdfParser::_formatDescription = formatDocument->root;
+	}
+
+	// Reading a file fills the description, so every document needs its own copy
+	doc->root = SdfParser::_formatDescription->Clone();
+
+	return true;
+}
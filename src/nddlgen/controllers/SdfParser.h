@@ -17,15 +17,22 @@
 #ifndef NDDLGEN_CONTROLLERS_SDFPARSER_H_
 #define NDDLGEN_CONTROLLERS_SDFPARSER_H_
 
+#include <string>
+
 #include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
 #include <sdf/sdf.hh>
 
+#include <nddlgen/controllers/SdfSceneExtractor.h>
+
 #include <nddlgen/exceptions/InitializingSdfException.hpp>
 #include <nddlgen/exceptions/ReadingSdfFileException.hpp>
 #include <nddlgen/exceptions/SdfInputFileNotSetException.hpp>
 #include <nddlgen/exceptions/FileMustBeSdfException.hpp>
 #include <nddlgen/exceptions/FileDoesNotExistException.hpp>
-#include <nddlgen/utilities/StdCerrHandler.h>
+#include <nddlgen/utilities/MappedFile.h>
+#include <nddlgen/utilities/SceneRecord.h>
+#include <nddlgen/utilities/StdCerrCapture.h>
 #include <nddlgen/utilities/Types.hpp>
 #include <nddlgen/utilities/WorkflowControllerConfig.h>
 
@@ -53,11 +60,33 @@ class nddlgen::controllers::SdfParser
 		 */
 		nddlgen::utilities::WorkflowControllerConfigPtr _config;
 
+		/**
+		 * Guards the format description, which is shared by all parsers of the process.
+		 */
+		static boost::mutex _formatDescriptionMutex;
+
+		/**
+		 * Root element of the SDF format description as loaded from the installed
+		 * sdf_format.xml file. Null until the first parse succeeded to initialize it.
+		 */
+		static sdf::ElementPtr _formatDescription;
+
 		/**
 		 * Helper to ensure that all assertions are met.
 		 */
 		void checkAssertions();
 
+		/**
+		 * Initializes a new SDF document with the format description. The format description is
+		 * only loaded once per process, every further document gets a copy of it.
+		 *
+		 * @param doc Document to be initialized
+		 *
+		 * @return True, if the document was initialized, false if the format description
+		 * could not be loaded.
+		 */
+		static bool initDocument(sdf::SDFPtr doc);
+
 	public:
 
 		/**
@@ -79,6 +108,15 @@ class nddlgen::controllers::SdfParser
 		 */
 		nddlgen::types::SdfRoot parseSdf();
 
+		/**
+		 * Parses the SDF file as specified in workflow controller configuration object into a
+		 * scene record. If enabled in the configuration, the streaming parser is tried first.
+		 * If it can not handle the file, or it is disabled, the file is parsed by the SDF library.
+		 *
+		 * @return Scene record of the SDF file
+		 */
+		nddlgen::utilities::SceneRecordPtr parseScene();
+
 };
 
 #endif
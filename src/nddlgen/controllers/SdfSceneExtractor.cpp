@@ -0,0 +1,611 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/controllers/SdfSceneExtractor.h>
+
+nddlgen::controllers::SdfSceneExtractor::SdfSceneExtractor()
+{
+	this->_position = 0;
+	this->_end = 0;
+	this->_hasRoot = false;
+	this->_worldCount = 0;
+	this->_model = 0;
+	this->_link = 0;
+	this->_hasModelPose = false;
+	this->_hasVisual = false;
+	this->_hasVisualPose = false;
+	this->_hasGeometry = false;
+	this->_hasBox = false;
+	this->_hasSize = false;
+	this->_visualDepth = 0;
+	this->_geometryDepth = 0;
+	this->_boxDepth = 0;
+	this->_capture = 0;
+	this->_captureDepth = 0;
+}
+
+nddlgen::controllers::SdfSceneExtractor::~SdfSceneExtractor()
+{
+
+}
+
+nddlgen::utilities::SceneRecordPtr nddlgen::controllers::SdfSceneExtractor::extract(const char* data,
+		std::size_t length)
+{
+	// Reset state of a previous extraction
+	this->_position = data;
+	this->_end = data + length;
+	this->_path.clear();
+	this->_hasRoot = false;
+	this->_worldCount = 0;
+	this->_scene.reset(new nddlgen::utilities::SceneRecord());
+	this->_model = 0;
+	this->_link = 0;
+	this->_visualDepth = 0;
+	this->_geometryDepth = 0;
+	this->_boxDepth = 0;
+	this->_capture = 0;
+
+	// Skip UTF-8 byte order mark
+	if (this->startsWith("\xEF\xBB\xBF"))
+	{
+		this->_position += 3;
+	}
+
+	// Handle the document markup by markup
+	while (this->_position < this->_end)
+	{
+		if (*this->_position != '<')
+		{
+			this->parseText();
+		}
+		else if (this->startsWith("<!--"))
+		{
+			this->skipPast("-->");
+		}
+		else if (this->startsWith("<?"))
+		{
+			this->skipPast("?>");
+		}
+		else if (this->startsWith("<!"))
+		{
+			throw nddlgen::exceptions::UnsupportedSdfException("DTDs and CDATA sections are not supported");
+		}
+		else if (this->startsWith("</"))
+		{
+			this->parseEndTag();
+		}
+		else
+		{
+			this->parseStartTag();
+		}
+	}
+
+	if (!this->_path.empty())
+	{
+		throw nddlgen::exceptions::UnsupportedSdfException("unexpected end of document");
+	}
+
+	if (this->_worldCount == 0)
+	{
+		throw nddlgen::exceptions::UnsupportedSdfException("document does not contain a world");
+	}
+
+	nddlgen::utilities::SceneRecordPtr scene = this->_scene;
+	this->_scene.reset();
+
+	return scene;
+}
+
+void nddlgen::controllers::SdfSceneExtractor::parseStartTag()
+{
+	// Skip '<'
+	this->_position++;
+
+	std::string name = this->readName();
+
+	// Only the name and version attributes are of interest
+	std::string nameAttribute;
+	std::string versionAttribute;
+	bool hasNameAttribute = false;
+	bool hasVersionAttribute = false;
+	bool isEmptyElement = false;
+
+	while (true)
+	{
+		this->skipWhitespace();
+
+		if (this->_position >= this->_end)
+		{
+			throw nddlgen::exceptions::UnsupportedSdfException("unexpected end of document");
+		}
+
+		if (*this->_position == '>')
+		{
+			this->_position++;
+			break;
+		}
+
+		if (this->startsWith("/>"))
+		{
+			this->_position += 2;
+			isEmptyElement = true;
+			break;
+		}
+
+		std::string attribute = this->readName();
+
+		this->skipWhitespace();
+
+		if (this->_position >= this->_end || *this->_position != '=')
+		{
+			throw nddlgen::exceptions::UnsupportedSdfException("malformed attribute " + attribute);
+		}
+
+		this->_position++;
+		this->skipWhitespace();
+
+		if (this->_position >= this->_end || (*this->_position != '"' && *this->_position != '\''))
+		{
+			throw nddlgen::exceptions::UnsupportedSdfException("malformed attribute " + attribute);
+		}
+
+		// Find closing quote
+		char quote = *this->_position++;
+		const char* valueBegin = this->_position;
+		const char* valueEnd = static_cast<const char*>(memchr(valueBegin, quote, this->_end - valueBegin));
+
+		if (!valueEnd)
+		{
+			throw nddlgen::exceptions::UnsupportedSdfException("unexpected end of document");
+		}
+
+		this->_position = valueEnd + 1;
+
+		if (attribute == "name")
+		{
+			this->appendDecoded(nameAttribute, valueBegin, valueEnd);
+			hasNameAttribute = true;
+		}
+		else if (attribute == "version")
+		{
+			this->appendDecoded(versionAttribute, valueBegin, valueEnd);
+			hasVersionAttribute = true;
+		}
+	}
+
+	this->startElement(name, hasNameAttribute ? &nameAttribute : 0, hasVersionAttribute ? &versionAttribute : 0);
+	this->_path.push_back(name);
+
+	if (isEmptyElement)
+	{
+		this->endElement();
+	}
+}
+
+void nddlgen::controllers::SdfSceneExtractor::parseEndTag()
+{
+	// Skip '</'
+	this->_position += 2;
+
+	std::string name = this->readName();
+
+	this->skipWhitespace();
+
+	if (this->_position >= this->_end || *this->_position != '>')
+	{
+		throw nddlgen::exceptions::UnsupportedSdfException("malformed end tag " + name);
+	}
+
+	this->_position++;
+
+	if (this->_path.empty() || this->_path.back() != name)
+	{
+		throw nddlgen::exceptions::UnsupportedSdfException("unexpected end tag " + name);
+	}
+
+	this->endElement();
+}
+
+void nddlgen::controllers::SdfSceneExtractor::parseText()
+{
+	const char* begin = this->_position;
+	const char* end = static_cast<const char*>(memchr(begin, '<', this->_end - begin));
+
+	if (!end)
+	{
+		end = this->_end;
+	}
+
+	this->_position = end;
+
+	if (this->_capture)
+	{
+		this->appendDecoded(this->_text, begin, end);
+	}
+	else if (this->_path.empty())
+	{
+		// Outside of the root element, only whitespace is allowed
+		for (const char* character = begin; character < end; character++)
+		{
+			if (!SdfSceneExtractor::isWhitespace(*character))
+			{
+				throw nddlgen::exceptions::UnsupportedSdfException("text outside of the root element");
+			}
+		}
+	}
+}
+
+void nddlgen::controllers::SdfSceneExtractor::startElement(const std::string& name,
+		const std::string* nameAttribute, const std::string* versionAttribute)
+{
+	// Amount of open ancestors of the new element
+	int depth = this->_path.size();
+
+	if (this->_capture)
+	{
+		throw nddlgen::exceptions::UnsupportedSdfException("unexpected element " + name + " within a value");
+	}
+
+	// Root element must be a known SDF version, so no conversion is needed
+	if (depth == 0)
+	{
+		if (this->_hasRoot || name != "sdf")
+		{
+			throw nddlgen::exceptions::UnsupportedSdfException("root element must be a single sdf element");
+		}
+
+		if (!versionAttribute || !SdfSceneExtractor::isSupportedVersion(*versionAttribute))
+		{
+			throw nddlgen::exceptions::UnsupportedSdfException("SDF version is not supported");
+		}
+
+		this->_hasRoot = true;
+
+		return;
+	}
+
+	if (depth == 1 && name == "world")
+	{
+		this->_worldCount++;
+
+		return;
+	}
+
+	// Only descendants of the first world are extracted. Siblings of the world have no
+	// ancestor besides the root
+	if (depth < 2 || this->_worldCount != 1 || this->_path[1] != "world")
+	{
+		return;
+	}
+
+	// Included models are resolved by the SDF library
+	if (name == "include")
+	{
+		throw nddlgen::exceptions::UnsupportedSdfException("included models are not supported");
+	}
+
+	if (depth == 2 && name == "model")
+	{
+		if (!nameAttribute)
+		{
+			throw nddlgen::exceptions::UnsupportedSdfException("model without a name");
+		}
+
+		this->_model = &this->_scene->addModel(*nameAttribute);
+		this->_hasModelPose = false;
+	}
+	else if (depth == 3 && this->_model)
+	{
+		if (name == "pose" && !this->_hasModelPose)
+		{
+			this->_hasModelPose = true;
+			this->capture(this->_model->pose);
+		}
+		else if (name == "link")
+		{
+			if (!nameAttribute)
+			{
+				throw nddlgen::exceptions::UnsupportedSdfException("link without a name");
+			}
+
+			this->_link = &nddlgen::utilities::SceneRecord::addLink(*this->_model, *nameAttribute);
+			this->_hasVisual = false;
+		}
+	}
+	else if (depth == 4 && this->_link)
+	{
+		if (name == "visual" && !this->_hasVisual)
+		{
+			this->_hasVisual = true;
+			this->_hasVisualPose = false;
+			this->_hasGeometry = false;
+			this->_visualDepth = depth + 1;
+		}
+	}
+	else if (depth == this->_visualDepth)
+	{
+		if (name == "pose" && !this->_hasVisualPose)
+		{
+			this->_hasVisualPose = true;
+			this->capture(this->_link->visualPose);
+		}
+		else if (name == "geometry" && !this->_hasGeometry)
+		{
+			this->_hasGeometry = true;
+			this->_hasBox = false;
+			this->_geometryDepth = depth + 1;
+		}
+	}
+	else if (depth == this->_geometryDepth)
+	{
+		if (name == "box" && !this->_hasBox)
+		{
+			this->_hasBox = true;
+			this->_hasSize = false;
+			this->_boxDepth = depth + 1;
+		}
+	}
+	else if (depth == this->_boxDepth)
+	{
+		if (name == "size" && !this->_hasSize)
+		{
+			this->_hasSize = true;
+			this->capture(this->_link->boxSize);
+		}
+	}
+}
+
+void nddlgen::controllers::SdfSceneExtractor::endElement()
+{
+	int depth = this->_path.size();
+
+	// Store captured value without surrounding whitespace
+	if (this->_capture && depth == this->_captureDepth)
+	{
+		std::size_t first = this->_text.find_first_not_of(" \t\r\n");
+		std::size_t last = this->_text.find_last_not_of(" \t\r\n");
+
+		if (first == std::string::npos)
+		{
+			throw nddlgen::exceptions::UnsupportedSdfException("empty value in " + this->_path.back());
+		}
+
+		this->_capture->assign(this->_text, first, last - first + 1);
+		SdfSceneExtractor::valueNormalizationHelper(this->_path.back(), *this->_capture);
+		this->_capture = 0;
+	}
+
+	// Leave the elements of the current link and model
+	if (depth == this->_boxDepth)
+	{
+		this->_boxDepth = 0;
+	}
+	else if (depth == this->_geometryDepth)
+	{
+		this->_geometryDepth = 0;
+	}
+	else if (depth == this->_visualDepth)
+	{
+		this->_visualDepth = 0;
+	}
+	else if (depth == 4)
+	{
+		this->_link = 0;
+	}
+	else if (depth == 3)
+	{
+		this->_model = 0;
+	}
+
+	this->_path.pop_back();
+}
+
+void nddlgen::controllers::SdfSceneExtractor::capture(std::string& value)
+{
+	this->_capture = &value;
+	this->_captureDepth = this->_path.size() + 1;
+	this->_text.clear();
+}
+
+std::string nddlgen::controllers::SdfSceneExtractor::readName()
+{
+	const char* begin = this->_position;
+
+	while (this->_position < this->_end && !SdfSceneExtractor::isWhitespace(*this->_position)
+			&& !strchr("<>/=\"'", *this->_position))
+	{
+		this->_position++;
+	}
+
+	if (this->_position == begin)
+	{
+		throw nddlgen::exceptions::UnsupportedSdfException("malformed markup");
+	}
+
+	return std::string(begin, this->_position);
+}
+
+void nddlgen::controllers::SdfSceneExtractor::appendDecoded(std::string& value, const char* begin,
+		const char* end)
+{
+	static const char* entities[5][2] = {
+			{ "&lt;", "<" }, { "&gt;", ">" }, { "&amp;", "&" }, { "&quot;", "\"" }, { "&apos;", "'" }
+	};
+
+	while (begin < end)
+	{
+		const char* ampersand = static_cast<const char*>(memchr(begin, '&', end - begin));
+
+		if (!ampersand)
+		{
+			value.append(begin, end);
+			return;
+		}
+
+		value.append(begin, ampersand);
+
+		// Replace predefined entity
+		int entity = 0;
+
+		for (; entity < 5; entity++)
+		{
+			std::size_t length = strlen(entities[entity][0]);
+
+			if ((std::size_t) (end - ampersand) >= length && strncmp(ampersand, entities[entity][0], length) == 0)
+			{
+				break;
+			}
+		}
+
+		if (entity == 5)
+		{
+			throw nddlgen::exceptions::UnsupportedSdfException("character references are not supported");
+		}
+
+		value.append(entities[entity][1]);
+		begin = ampersand + strlen(entities[entity][0]);
+	}
+}
+
+void nddlgen::controllers::SdfSceneExtractor::skipWhitespace()
+{
+	while (this->_position < this->_end && SdfSceneExtractor::isWhitespace(*this->_position))
+	{
+		this->_position++;
+	}
+}
+
+void nddlgen::controllers::SdfSceneExtractor::skipPast(const char* terminator)
+{
+	std::size_t length = strlen(terminator);
+
+	while (this->_position < this->_end && !this->startsWith(terminator))
+	{
+		this->_position++;
+	}
+
+	if (this->_position >= this->_end)
+	{
+		throw nddlgen::exceptions::UnsupportedSdfException("unexpected end of document");
+	}
+
+	this->_position += length;
+}
+
+bool nddlgen::controllers::SdfSceneExtractor::startsWith(const char* prefix)
+{
+	std::size_t length = strlen(prefix);
+
+	return (std::size_t) (this->_end - this->_position) >= length && memcmp(this->_position, prefix, length) == 0;
+}
+
+bool nddlgen::controllers::SdfSceneExtractor::isWhitespace(char character)
+{
+	return character == ' ' || character == '\t' || character == '\r' || character == '\n';
+}
+
+bool nddlgen::controllers::SdfSceneExtractor::numbersParsingHelper(const std::string& value,
+		double* numbers, int count)
+{
+	std::istringstream stream(value);
+
+	for (int i = 0; i < count; i++)
+	{
+		if (!(stream >> numbers[i]))
+		{
+			return false;
+		}
+	}
+
+	stream >> std::ws;
+
+	return stream.eof();
+}
+
+void nddlgen::controllers::SdfSceneExtractor::valueNormalizationHelper(const std::string& name,
+		std::string& value)
+{
+	std::ostringstream text;
+
+	if (name == "size")
+	{
+		double size[3];
+
+		if (!SdfSceneExtractor::numbersParsingHelper(value, size, 3))
+		{
+			throw nddlgen::exceptions::UnsupportedSdfException("malformed size " + value);
+		}
+
+		text << size[0] << " " << size[1] << " " << size[2];
+	}
+	else
+	{
+		double pose[6];
+
+		if (!SdfSceneExtractor::numbersParsingHelper(value, pose, 6))
+		{
+			throw nddlgen::exceptions::UnsupportedSdfException("malformed pose " + value);
+		}
+
+		// Quaternion of roll, pitch and yaw, normalized, as done by the SDF library
+		double cosRoll = std::cos(pose[3] / 2.0);
+		double sinRoll = std::sin(pose[3] / 2.0);
+		double cosPitch = std::cos(pose[4] / 2.0);
+		double sinPitch = std::sin(pose[4] / 2.0);
+		double cosYaw = std::cos(pose[5] / 2.0);
+		double sinYaw = std::sin(pose[5] / 2.0);
+
+		double q[4] = {
+				cosRoll * cosPitch * cosYaw + sinRoll * sinPitch * sinYaw,
+				sinRoll * cosPitch * cosYaw - cosRoll * sinPitch * sinYaw,
+				cosRoll * sinPitch * cosYaw + sinRoll * cosPitch * sinYaw,
+				cosRoll * cosPitch * sinYaw - sinRoll * sinPitch * cosYaw
+		};
+
+		// The SDF library normalizes once when setting and once when reading the angles
+		for (int pass = 0; pass < 2; pass++)
+		{
+			double norm = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+
+			for (int i = 0; i < 4; i++)
+			{
+				q[i] /= norm;
+			}
+		}
+
+		double squ = q[0] * q[0];
+		double sqx = q[1] * q[1];
+		double sqy = q[2] * q[2];
+		double sqz = q[3] * q[3];
+
+		double roll = std::atan2(2 * (q[2] * q[3] + q[0] * q[1]), squ - sqx - sqy + sqz);
+		double sarg = -2 * (q[1] * q[3] - q[0] * q[2]);
+		double pitch = sarg <= -1.0 ? -0.5 * M_PI : (sarg >= 1.0 ? 0.5 * M_PI : std::asin(sarg));
+		double yaw = std::atan2(2 * (q[1] * q[2] + q[0] * q[3]), squ + sqx - sqy - sqz);
+
+		text << pose[0] << " " << pose[1] << " " << pose[2] << " " << roll << " " << pitch << " " << yaw;
+	}
+
+	value = text.str();
+}
+
+bool nddlgen::controllers::SdfSceneExtractor::isSupportedVersion(const std::string& version)
+{
+	// Versions the SDF library converts to the latest one it knows without touching poses
+	// and boxes. Newer versions are rejected by it
+	return version == "1.4" || version == "1.5";
+}
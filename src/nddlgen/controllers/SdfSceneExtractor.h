@@ -0,0 +1,222 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_CONTROLLERS_SDFSCENEEXTRACTOR_H_
+#define NDDLGEN_CONTROLLERS_SDFSCENEEXTRACTOR_H_
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <nddlgen/exceptions/UnsupportedSdfException.hpp>
+#include <nddlgen/utilities/SceneRecord.h>
+
+namespace nddlgen
+{
+	namespace controllers
+	{
+		class SdfSceneExtractor;
+		typedef boost::shared_ptr<nddlgen::controllers::SdfSceneExtractor> SdfSceneExtractorPtr;
+	}
+}
+
+/**
+ * Streaming parser reading a scene record directly from the XML of an SDF file, without
+ * building a document tree or validating it against the SDF format description. Only the
+ * elements that end up in the scene record are looked at, everything else is skipped.
+ *
+ * Features the result of the SDF library can not be reproduced for without it, like included
+ * models, SDF versions the SDF library does not know, DTDs or CDATA sections, make the
+ * extractor throw an UnsupportedSdfException, so the caller can fall back to the SDF library.
+ *
+ * Poses and sizes are written the way the SDF library writes its values back as text, so
+ * both yield the same bounding boxes: Numbers with 6 significant digits, and rotations
+ * converted to a quaternion and back to normalized roll, pitch and yaw.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::controllers::SdfSceneExtractor
+{
+
+	private:
+
+		/**
+		 * Current position within the input, and its end.
+		 */
+		const char* _position;
+		const char* _end;
+
+		/**
+		 * Names of all open elements, starting with the root element.
+		 */
+		std::vector<std::string> _path;
+
+		/**
+		 * True, once the root element was seen.
+		 */
+		bool _hasRoot;
+
+		/**
+		 * Amount of world elements seen so far. Only the first world is extracted.
+		 */
+		int _worldCount;
+
+		/**
+		 * Scene record being extracted, and its current model and link, or null.
+		 */
+		nddlgen::utilities::SceneRecordPtr _scene;
+		nddlgen::utilities::SceneRecord::Model* _model;
+		nddlgen::utilities::SceneRecord::Link* _link;
+
+		/**
+		 * Flags to only extract the first element of each name, as the SDF library does.
+		 */
+		bool _hasModelPose;
+		bool _hasVisual;
+		bool _hasVisualPose;
+		bool _hasGeometry;
+		bool _hasBox;
+		bool _hasSize;
+
+		/**
+		 * Depths of the first visual, geometry and box element of the current link, or 0.
+		 */
+		int _visualDepth;
+		int _geometryDepth;
+		int _boxDepth;
+
+		/**
+		 * Value receiving the text of the element at _captureDepth, or null.
+		 */
+		std::string* _capture;
+		int _captureDepth;
+		std::string _text;
+
+		/**
+		 * Parses a start tag, including its attributes, and handles it.
+		 */
+		void parseStartTag();
+
+		/**
+		 * Parses an end tag and handles it.
+		 */
+		void parseEndTag();
+
+		/**
+		 * Parses text between tags.
+		 */
+		void parseText();
+
+		/**
+		 * Handles the start of an element. The element is not yet part of _path.
+		 */
+		void startElement(const std::string& name, const std::string* nameAttribute,
+				const std::string* versionAttribute);
+
+		/**
+		 * Handles the end of the innermost element.
+		 */
+		void endElement();
+
+		/**
+		 * Starts capturing the text of the current element into value.
+		 */
+		void capture(std::string& value);
+
+		/**
+		 * Reads an XML name at the current position.
+		 */
+		std::string readName();
+
+		/**
+		 * Appends text to value, replacing the predefined XML entities.
+		 */
+		void appendDecoded(std::string& value, const char* begin, const char* end);
+
+		/**
+		 * Skips whitespace at the current position.
+		 */
+		void skipWhitespace();
+
+		/**
+		 * Skips everything up to and including terminator.
+		 */
+		void skipPast(const char* terminator);
+
+		/**
+		 * Tests if the input continues with prefix at the current position.
+		 */
+		bool startsWith(const char* prefix);
+
+		/**
+		 * Reads exactly count numbers separated by whitespace from value.
+		 *
+		 * @return False, if value holds anything else.
+		 */
+		static bool numbersParsingHelper(const std::string& value, double* numbers, int count);
+
+		/**
+		 * Rewrites a captured pose or box size as the SDF library writes it back as text.
+		 *
+		 * @param name Name of the element holding the value
+		 * @param value Value to rewrite
+		 */
+		static void valueNormalizationHelper(const std::string& name, std::string& value);
+
+		/**
+		 * Tests if a character is XML whitespace.
+		 */
+		static bool isWhitespace(char character);
+
+		/**
+		 * Tests if an SDF version is known to the SDF library and read the same with and
+		 * without it.
+		 */
+		static bool isSupportedVersion(const std::string& version);
+
+	public:
+
+		/**
+		 * Constructs a new SDF scene extractor.
+		 */
+		SdfSceneExtractor();
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~SdfSceneExtractor();
+
+		/**
+		 * Extracts the scene record of the first world of an SDF document.
+		 *
+		 * @param data Content of the SDF file
+		 * @param length Length of the content in bytes
+		 *
+		 * @return Scene record.
+		 *
+		 * @throws UnsupportedSdfException if the document can not be handled without the SDF
+		 * library, including malformed XML.
+		 */
+		nddlgen::utilities::SceneRecordPtr extract(const char* data, std::size_t length);
+
+};
+
+#endif
@@ -22,12 +22,28 @@ nddlgen::controllers::WorkflowController::WorkflowController(nddlgen::utilities:
 	config->setReadOnly();
 	this->_config = config;
 
+	// Start worker threads once, so all steps of the workflow can use them
+	this->_threadPool.reset(new nddlgen::utilities::ThreadPool(config->getThreadCount()));
+
+	if (config->getSceneCacheDirectory() != "")
+	{
+		this->_sceneCache.reset(new nddlgen::utilities::SceneCache(config->getSceneCacheDirectory(),
+				config->getSceneCacheSizeLimit()));
+	}
+
+	this->_sceneCacheKey.value = 0;
+	this->_sceneCacheKey.checksum = 0;
+	this->_sceneCacheKey.sdfInputSize = 0;
+	this->_sceneCacheKey.isdInputSize = 0;
+	this->_hasSceneCacheKey = false;
+
 	// Workflow control flags
 	this->_isSdfInputFileParsed = false;
 	this->_isIsdInputFileParsed = false;
 	this->_isDomainDescriptionBuilt = false;
 	this->_isNddlModelFileWritten = false;
 	this->_isNddlInitialStateFileWritten = false;
+	this->_isSceneCached = false;
 }
 
 nddlgen::controllers::WorkflowController::~WorkflowController()
@@ -43,14 +59,11 @@ void nddlgen::controllers::WorkflowController::parseSdfInputFile()
 		throw nddlgen::exceptions::WorkflowException("SDF input file has already been parsed.");
 	}
 
-	// Instantiate SdfParser and pass WorkflowControllerConfig object
-	nddlgen::controllers::SdfParserPtr parser(new nddlgen::controllers::SdfParser(this->_config));
-
-	// Parse SDF and write root to member
-	this->_sdfRoot = parser->parseSdf();
-
-	// Set workflow control flag
-	this->_isSdfInputFileParsed = true;
+	// A cached scene makes parsing unnecessary
+	if (!this->sceneCacheLoadingHelper())
+	{
+		this->sdfParsingHelper();
+	}
 }
 
 void nddlgen::controllers::WorkflowController::parseIsdInputFile()
@@ -61,16 +74,71 @@ void nddlgen::controllers::WorkflowController::parseIsdInputFile()
 		throw nddlgen::exceptions::WorkflowException("ISD input file has already been parsed.");
 	}
 
-	// Instantiate IsdParser and pass WorkflowControllerConfig object
-	nddlgen::controllers::IsdParserPtr parser(new nddlgen::controllers::IsdParser(this->_config));
+	// The goals of a cached scene were read from the cache along with it
+	if (!this->_isSceneCached)
+	{
+		// Instantiate IsdParser and pass WorkflowControllerConfig object
+		nddlgen::controllers::IsdParserPtr parser(new nddlgen::controllers::IsdParser(this->_config));
 
-	// Parse ISD and write root to member
-	this->_isdRoot = parser->parseIsd();
+		// Parse ISD and write root to member
+		this->_isdRoot = parser->parseIsd();
+	}
 
 	// Set workflow control flag
 	this->_isIsdInputFileParsed = true;
 }
 
+void nddlgen::controllers::WorkflowController::parseInputFiles()
+{
+	// Without an ISD input file, there is nothing to parse concurrently
+	if (this->_config->getIsdInputFile() == "")
+	{
+		this->parseSdfInputFile();
+		return;
+	}
+
+	// Assert that neither input file has been parsed yet, so no thread needs to be started
+	// for nothing
+	if (this->_isSdfInputFileParsed)
+	{
+		throw nddlgen::exceptions::WorkflowException("SDF input file has already been parsed.");
+	}
+
+	if (this->_isIsdInputFileParsed)
+	{
+		throw nddlgen::exceptions::WorkflowException("ISD input file has already been parsed.");
+	}
+
+	// A cached scene makes parsing unnecessary
+	if (this->sceneCacheLoadingHelper())
+	{
+		this->parseIsdInputFile();
+		return;
+	}
+
+	// Parse ISD on a separate thread, while the SDF is parsed on this one
+	std::exception_ptr isdException;
+	boost::thread isdThread(boost::bind(&WorkflowController::isdParsingHelper, this, boost::ref(isdException)));
+
+	try
+	{
+		this->sdfParsingHelper();
+	}
+	catch (...)
+	{
+		// Do not leave the ISD thread running on members of this object
+		isdThread.join();
+		throw;
+	}
+
+	isdThread.join();
+
+	if (isdException)
+	{
+		std::rethrow_exception(isdException);
+	}
+}
+
 void nddlgen::controllers::WorkflowController::buildDomainDescription()
 {
 	// Assert that at least the SDF input file has been parsed
@@ -88,9 +156,33 @@ void nddlgen::controllers::WorkflowController::buildDomainDescription()
 	// Instantiate and initialize DomainDescriptionFactory
 	nddlgen::controllers::DomainDescriptionFactoryPtr factory(new nddlgen::controllers::DomainDescriptionFactory());
 	factory->setObjectFactory(this->_config->getObjectFactory());
+	factory->setBroadPhase(this->_config->getBroadPhase());
+	factory->setThreadPool(this->_threadPool);
+	factory->setParallelObjectCreation(this->_config->isParallelObjectCreation());
+	factory->setCollisionState(this->_config->getCollisionState());
+
+	// Add the goals of the ISD to the scene, unless they were read from the scene cache
+	if (this->_isdRoot && !this->_isSceneCached)
+	{
+		this->_scene->addGoalsFromIsd(this->_isdRoot);
+	}
 
 	// Build the domain description model
-	this->_domainDescription = factory->build(this->_sdfRoot, this->_isdRoot);
+	this->_domainDescription = factory->build(this->_scene);
+
+	// Render NDDL classes and actions on the thread pool, if enabled
+	if (this->_config->isParallelRendering())
+	{
+		this->_domainDescription->setThreadPool(this->_threadPool);
+	}
+
+	// Cache the scene along with the bounding boxes built from it. If an ISD input file is set
+	// but was not parsed, the goals are missing and the scene must not be stored for its key
+	if (this->_hasSceneCacheKey && !this->_isSceneCached
+			&& (this->_config->getIsdInputFile() == "" || this->_isIsdInputFileParsed))
+	{
+		this->_sceneCache->store(this->_sceneCacheKey, this->_scene);
+	}
 
 	// Set workflow control flag
 	this->_isDomainDescriptionBuilt = true;
@@ -156,3 +248,152 @@ void nddlgen::controllers::WorkflowController::writeNddlInitialStateFile(bool fo
 	// Set workflow control flag
 	this->_isNddlInitialStateFileWritten = true;
 }
+
+void nddlgen::controllers::WorkflowController::writeNddlModel(nddlgen::utilities::OutputSink& outputSink)
+{
+	// Assert that the domain description was built
+	if (!this->_isDomainDescriptionBuilt)
+	{
+		throw nddlgen::exceptions::WorkflowException("Domain description was not built.");
+	}
+
+	// Generate model into output sink
+	nddlgen::controllers::NddlGenerationController::generateModel(this->_domainDescription, this->_config, outputSink);
+}
+
+void nddlgen::controllers::WorkflowController::writeNddlInitialState(nddlgen::utilities::OutputSink& outputSink)
+{
+	// Assert that an ISD input file has been set and parsed
+	if (!this->_isIsdInputFileParsed)
+	{
+		throw nddlgen::exceptions::WorkflowException("An NDDL initial state cannot be generated"
+				" without an ISD input file being set and parsed.");
+	}
+
+	// Assert that the domain description was built
+	if (!this->_isDomainDescriptionBuilt)
+	{
+		throw nddlgen::exceptions::WorkflowException("Domain description was not built.");
+	}
+
+	// Generate initial state into output sink
+	nddlgen::controllers::NddlGenerationController::generateInitialState(this->_domainDescription, this->_config, outputSink);
+}
+
+std::string nddlgen::controllers::WorkflowController::getNddlModel()
+{
+	nddlgen::utilities::MemoryOutputSink outputSink;
+
+	this->writeNddlModel(outputSink);
+
+	// Take the text over instead of copying it
+	std::string model;
+	outputSink.swapData(model);
+
+	return model;
+}
+
+std::string nddlgen::controllers::WorkflowController::getNddlInitialState()
+{
+	nddlgen::utilities::MemoryOutputSink outputSink;
+
+	this->writeNddlInitialState(outputSink);
+
+	// Take the text over instead of copying it
+	std::string initialState;
+	outputSink.swapData(initialState);
+
+	return initialState;
+}
+
+void nddlgen::controllers::WorkflowController::sdfParsingHelper()
+{
+	// Instantiate SdfParser and pass WorkflowControllerConfig object
+	nddlgen::controllers::SdfParserPtr parser(new nddlgen::controllers::SdfParser(this->_config));
+
+	// Parse SDF and write scene record to member
+	this->_scene = parser->parseScene();
+
+	// Set workflow control flag
+	this->_isSdfInputFileParsed = true;
+}
+
+void nddlgen::controllers::WorkflowController::isdParsingHelper(std::exception_ptr& exception)
+{
+	try
+	{
+		this->parseIsdInputFile();
+	}
+	catch (...)
+	{
+		exception = std::current_exception();
+	}
+}
+
+bool nddlgen::controllers::WorkflowController::sceneCacheLoadingHelper()
+{
+	if (!this->_sceneCache)
+	{
+		return false;
+	}
+
+	// The key covers the contents of the input files and how they are parsed
+	nddlgen::utilities::ContentHash key;
+	key.update(std::string(this->_config->isStreamingSdfParsing() ? "streaming" : "library"));
+
+	boost::uint64_t sdfInputSize = 0;
+	boost::uint64_t isdInputSize = 0;
+
+	try
+	{
+		nddlgen::utilities::MappedFile sdfInputFile(this->_config->getSdfInputFile());
+
+		// Included files are resolved by the SDF library and not covered by the key, so a
+		// cached scene could be outdated. The check is conservative, it also matches includes
+		// within comments
+		if (boost::string_ref(sdfInputFile.getData(), sdfInputFile.getSize()).find("<include")
+				!= boost::string_ref::npos)
+		{
+			return false;
+		}
+
+		sdfInputSize = sdfInputFile.getSize();
+		key.update(sdfInputSize);
+		key.update(sdfInputFile.getData(), sdfInputFile.getSize());
+
+		bool hasIsdInputFile = this->_config->getIsdInputFile() != "";
+		key.update((boost::uint64_t) hasIsdInputFile);
+
+		if (hasIsdInputFile)
+		{
+			nddlgen::utilities::MappedFile isdInputFile(this->_config->getIsdInputFile());
+			isdInputSize = isdInputFile.getSize();
+			key.update(isdInputSize);
+			key.update(isdInputFile.getData(), isdInputFile.getSize());
+		}
+	}
+	catch (const nddlgen::exceptions::MappingFileException&)
+	{
+		// Leave reporting missing or unreadable input files to the parsers
+		return false;
+	}
+
+	this->_sceneCacheKey.value = key.getValue();
+	this->_sceneCacheKey.checksum = key.getChecksum();
+	this->_sceneCacheKey.sdfInputSize = sdfInputSize;
+	this->_sceneCacheKey.isdInputSize = isdInputSize;
+	this->_hasSceneCacheKey = true;
+
+	nddlgen::utilities::SceneRecordPtr scene = this->_sceneCache->load(this->_sceneCacheKey);
+
+	if (!scene)
+	{
+		return false;
+	}
+
+	this->_scene = scene;
+	this->_isSceneCached = true;
+	this->_isSdfInputFileParsed = true;
+
+	return true;
+}
@@ -17,15 +17,28 @@
 #ifndef NDDLGEN_CONTROLLER_WORKFLOWCONTROLLER_H_
 #define NDDLGEN_CONTROLLER_WORKFLOWCONTROLLER_H_
 
+#include <exception>
 #include <string>
 
+#include <boost/bind.hpp>
+#include <boost/cstdint.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+#include <boost/utility/string_ref.hpp>
 
 #include <nddlgen/controllers/DomainDescriptionFactory.h>
 #include <nddlgen/controllers/SdfParser.h>
 #include <nddlgen/controllers/IsdParser.h>
 #include <nddlgen/controllers/NddlGenerationController.h>
+#include <nddlgen/exceptions/MappingFileException.hpp>
 #include <nddlgen/exceptions/WorkflowException.hpp>
+#include <nddlgen/utilities/ContentHash.h>
+#include <nddlgen/utilities/MappedFile.h>
+#include <nddlgen/utilities/MemoryOutputSink.h>
+#include <nddlgen/utilities/OutputSink.h>
+#include <nddlgen/utilities/SceneCache.h>
+#include <nddlgen/utilities/SceneRecord.h>
+#include <nddlgen/utilities/ThreadPool.h>
 #include <nddlgen/utilities/WorkflowControllerConfig.h>
 #include <nddlgen/utilities/Types.hpp>
 
@@ -74,15 +87,21 @@ class nddlgen::controllers::WorkflowController
 		 */
 		bool _isNddlInitialStateFileWritten;
 
+		/**
+		 * Workflow control flag to keep track if the scene was read from the scene cache
+		 * instead of parsing the input files.
+		 */
+		bool _isSceneCached;
+
 		/**
 		 * Object holding controller config to make it accessible for other controllers.
 		 */
 		nddlgen::utilities::WorkflowControllerConfigPtr _config;
 
 		/**
-		 * Root of the parsed SDF data structure.
+		 * Scene record of the parsed SDF file.
 		 */
-		nddlgen::types::SdfRoot _sdfRoot;
+		nddlgen::utilities::SceneRecordPtr _scene;
 
 		/**
 		 * Root of the parsed ISD data structure.
@@ -94,6 +113,50 @@ class nddlgen::controllers::WorkflowController
 		 */
 		nddlgen::models::DomainDescriptionModelPtr _domainDescription;
 
+		/**
+		 * Thread pool shared by all parallelizable steps of the workflow. Sized according to
+		 * the thread count of the configuration.
+		 */
+		nddlgen::utilities::ThreadPoolPtr _threadPool;
+
+		/**
+		 * Scene cache, or null if scenes are not cached.
+		 */
+		nddlgen::utilities::SceneCachePtr _sceneCache;
+
+		/**
+		 * Key of the input files within the scene cache.
+		 */
+		nddlgen::utilities::SceneCache::Key _sceneCacheKey;
+
+		/**
+		 * Flag to keep track if _sceneCacheKey was computed.
+		 */
+		bool _hasSceneCacheKey;
+
+		/**
+		 * Helper to read the scene from the scene cache. The key is computed from the contents
+		 * of the input files. SDF input files including other files are never cached, since
+		 * changes of the included files would not change the key. On a hit, the SDF input file counts as parsed, and so does the
+		 * ISD input file as soon as parseIsdInputFile() is called.
+		 *
+		 * @return True, if the scene was read from the cache, false if it has to be parsed.
+		 */
+		bool sceneCacheLoadingHelper();
+
+		/**
+		 * Helper to parse the SDF, regardless of the scene cache.
+		 */
+		void sdfParsingHelper();
+
+		/**
+		 * Helper to parse the ISD on a separate thread. Catches all exceptions, so they can be
+		 * rethrown on the calling thread.
+		 *
+		 * @param exception Receives the exception thrown while parsing, if any
+		 */
+		void isdParsingHelper(std::exception_ptr& exception);
+
 	public:
 
 		/**
@@ -110,16 +173,25 @@ class nddlgen::controllers::WorkflowController
 
 		/**
 		 * Parses the SDF into a data structure where possible collisions and
-		 * blocks can be computed.
+		 * blocks can be computed. If a scene cache is configured and holds the scene
+		 * of the current input files, it is read from there instead.
 		 */
 		void parseSdfInputFile();
 
 		/**
 		 * Parses the ISD into a data structure where possible collisions and
-		 * blocks can be computed.
+		 * blocks can be computed. Does nothing but updating the workflow state if
+		 * the scene was read from the scene cache.
 		 */
 		void parseIsdInputFile();
 
+		/**
+		 * Parses the SDF and the ISD concurrently, and returns after both were parsed. If no
+		 * ISD input file is set, only the SDF is parsed. If parsing fails, the exception of
+		 * the SDF is thrown in favour of the one of the ISD.
+		 */
+		void parseInputFiles();
+
 		/**
 		 * Uses parsed information from either the SDF or the SDF and ISD to
 		 * build a DomainDescription model which can be used to generate NDDL files.
@@ -154,6 +226,37 @@ class nddlgen::controllers::WorkflowController
 		 */
 		void writeNddlInitialStateFile(bool forceOverwrite);
 
+		/**
+		 * Uses the DomainDescription model to generate the NDDL model into an output sink,
+		 * which is closed afterwards. Unlike writeNddlModelFile(), this may be called repeatedly.
+		 *
+		 * @param outputSink Output sink
+		 */
+		void writeNddlModel(nddlgen::utilities::OutputSink& outputSink);
+
+		/**
+		 * Uses the DomainDescription model to generate the NDDL initial state into an output
+		 * sink, which is closed afterwards. Unlike writeNddlInitialStateFile(), this may be
+		 * called repeatedly.
+		 *
+		 * @param outputSink Output sink
+		 */
+		void writeNddlInitialState(nddlgen::utilities::OutputSink& outputSink);
+
+		/**
+		 * Uses the DomainDescription model to generate the NDDL model in memory.
+		 *
+		 * @return NDDL model
+		 */
+		std::string getNddlModel();
+
+		/**
+		 * Uses the DomainDescription model to generate the NDDL initial state in memory.
+		 *
+		 * @return NDDL initial state
+		 */
+		std::string getNddlInitialState();
+
 };
 
 #endif
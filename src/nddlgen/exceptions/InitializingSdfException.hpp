@@ -18,6 +18,7 @@
 #define NDDLGEN_EXCEPTIONS_INITIALIZINGSDFEXCEPTION_HPP_
 
 #include <exception>
+#include <string>
 
 namespace nddlgen { namespace exceptions { class InitializingSdfException; }}
 
@@ -26,17 +27,16 @@ class nddlgen::exceptions::InitializingSdfException : public std::exception
 
 	protected:
 
-		std::string _cerrOutput;
+		std::string _message;
 
 	public:
 
-		explicit InitializingSdfException(const std::string& message): _cerrOutput(message) {}
+		explicit InitializingSdfException(const std::string& cerrOutput): _message("Unable to initialize .sdf file.\n" + cerrOutput) {}
 		virtual ~InitializingSdfException() throw (){}
 
 		virtual const char* what() const throw()
 		{
-			std:: string errorMsg = "Unable to initialize .sdf file.\n" + this->_cerrOutput;
-			return errorMsg.c_str();
+			return this->_message.c_str();
 		}
 
 };
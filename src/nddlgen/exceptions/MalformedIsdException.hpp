@@ -14,41 +14,31 @@
  * limitations under the License.
  */
 
-#ifndef NDDLGEN_UTILITIES_STDCERRHANDLER_H_
-#define NDDLGEN_UTILITIES_STDCERRHANDLER_H_
+#ifndef NDDLGEN_EXCEPTIONS_MALFORMEDISDEXCEPTION_HPP_
+#define NDDLGEN_EXCEPTIONS_MALFORMEDISDEXCEPTION_HPP_
 
+#include <exception>
 #include <string>
-#include <sys/stat.h>
-#include <iostream>
-#include <sstream>
 
-namespace nddlgen { namespace utilities { class StdCerrHandler; }}
+namespace nddlgen { namespace exceptions { class MalformedIsdException; }}
 
-class nddlgen::utilities::StdCerrHandler
+class nddlgen::exceptions::MalformedIsdException : public std::exception
 {
 
-	private:
+	protected:
 
-		StdCerrHandler();
-		virtual ~StdCerrHandler();
-
-		/**
-		 * Stringstream to override the default cerr buffer.
-		 */
-		static std::stringstream _cerrOvRdBuf;
-
-		/**
-		 * Default cerr buffer.
-		 */
-		static std::streambuf* _cerrStdRdBuf;
+		std::string _message;
 
 	public:
 
-		static void disableCerr();
-
-		static void enableCerr();
+		MalformedIsdException(const std::string& reason):
+			_message("Malformed .isd file: " + reason) {}
+		virtual ~MalformedIsdException() throw (){}
 
-		static std::string getBufferedCerrOutput();
+		virtual const char* what() const throw()
+		{
+			return this->_message.c_str();
+		}
 
 };
 
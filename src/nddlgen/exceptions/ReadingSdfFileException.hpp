@@ -18,6 +18,7 @@
 #define NDDLGEN_EXCEPTIONS_READINGSDFFILEEXCEPTION_HPP_
 
 #include <exception>
+#include <string>
 
 namespace nddlgen { namespace exceptions { class ReadingSdfFileException; }}
 
@@ -26,17 +27,16 @@ class nddlgen::exceptions::ReadingSdfFileException : public std::exception
 
 	protected:
 
-		std::string _cerrOutput;
+		std::string _message;
 
 	public:
 
-		explicit ReadingSdfFileException(const std::string& message): _cerrOutput(message) {}
+		explicit ReadingSdfFileException(const std::string& cerrOutput): _message("Unable to read .sdf file.\n" + cerrOutput) {}
 		virtual ~ReadingSdfFileException() throw (){}
 
 		virtual const char* what() const throw()
 		{
-			std::string errorMsg = "Unable to read .sdf file.\n" + this->_cerrOutput;
-			return errorMsg.c_str();
+			return this->_message.c_str();
 		}
 
 };
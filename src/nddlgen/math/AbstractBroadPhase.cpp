@@ -14,11 +14,14 @@
  * limitations under the License.
  */
 
-#ifndef NDDLGEN_UTILITIES_WRITESTREAM_HPP_
-#define NDDLGEN_UTILITIES_WRITESTREAM_HPP_
+#include <nddlgen/math/AbstractBroadPhase.h>
 
-#define wrln(indents,line,endls) for(int i=0;i<indents;i++){ofStream<<"\t";}ofStream<<line;for(int i=0;i<endls;i++){ofStream<<std::endl;}
+nddlgen::math::AbstractBroadPhase::AbstractBroadPhase()
+{
 
-#define wrel(endls) wrln(0,"",endls)
+}
 
-#endif
+nddlgen::math::AbstractBroadPhase::~AbstractBroadPhase()
+{
+
+}
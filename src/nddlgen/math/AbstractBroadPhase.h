@@ -0,0 +1,79 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_MATH_ABSTRACTBROADPHASE_H_
+#define NDDLGEN_MATH_ABSTRACTBROADPHASE_H_
+
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <nddlgen/math/AxisAlignedBoundingBox.h>
+
+namespace nddlgen
+{
+	namespace math
+	{
+		class AbstractBroadPhase;
+		typedef boost::shared_ptr<nddlgen::math::AbstractBroadPhase> AbstractBroadPhasePtr;
+
+		/**
+		 * For each query box, the ascending indices of all target boxes it may collide with.
+		 */
+		typedef std::vector<std::vector<int> > CandidateList;
+	}
+}
+
+/**
+ * Abstract broad phase of the collision detection. A broad phase cheaply determines which
+ * pairs of boxes may collide, so that the expensive narrow phase (SAT test) only needs to
+ * run for these candidate pairs. Implementations may report pairs that do not collide, but
+ * must never omit a pair whose axis aligned bounding boxes overlap.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::math::AbstractBroadPhase
+{
+
+	public:
+
+		/**
+		 * Constructs a new broad phase.
+		 */
+		AbstractBroadPhase();
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~AbstractBroadPhase();
+
+		/**
+		 * Finds all candidate pairs between query boxes and target boxes.
+		 *
+		 * @param queryBoxes Boxes to be tested (e.g. accessibility bounding boxes)
+		 * @param targetBoxes Boxes to be tested against (e.g. object bounding boxes)
+		 *
+		 * @return List with one entry per query box, holding the ascending indices of all
+		 * target boxes which may collide with it
+		 */
+		virtual nddlgen::math::CandidateList findCandidates(
+				const std::vector<nddlgen::math::AxisAlignedBoundingBox>& queryBoxes,
+				const std::vector<nddlgen::math::AxisAlignedBoundingBox>& targetBoxes
+		) = 0;
+
+};
+
+#endif
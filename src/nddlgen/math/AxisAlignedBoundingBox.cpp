@@ -0,0 +1,99 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/math/AxisAlignedBoundingBox.h>
+
+nddlgen::math::AxisAlignedBoundingBox::AxisAlignedBoundingBox()
+{
+	for (int axis = 0; axis < 3; axis++)
+	{
+		this->_min[axis] = std::numeric_limits<double>::max();
+		this->_max[axis] = - std::numeric_limits<double>::max();
+	}
+}
+
+nddlgen::math::AxisAlignedBoundingBox::AxisAlignedBoundingBox(double minX, double minY, double minZ,
+		double maxX, double maxY, double maxZ)
+{
+	this->_min[0] = minX;
+	this->_min[1] = minY;
+	this->_min[2] = minZ;
+	this->_max[0] = maxX;
+	this->_max[1] = maxY;
+	this->_max[2] = maxZ;
+}
+
+nddlgen::math::AxisAlignedBoundingBox nddlgen::math::AxisAlignedBoundingBox::fromCuboid(
+		nddlgen::math::CuboidPtr cuboid)
+{
+	nddlgen::math::AxisAlignedBoundingBox box;
+
+	// The cuboid computed its bounds when it was built
+	for (int axis = 0; axis < 3; axis++)
+	{
+		box._min[axis] = cuboid->getMinimum(axis);
+		box._max[axis] = cuboid->getMaximum(axis);
+	}
+
+	return box;
+}
+
+void nddlgen::math::AxisAlignedBoundingBox::expand(const nddlgen::math::AxisAlignedBoundingBox& other)
+{
+	for (int axis = 0; axis < 3; axis++)
+	{
+		this->_min[axis] = Trivial::min(this->_min[axis], other._min[axis]);
+		this->_max[axis] = Trivial::max(this->_max[axis], other._max[axis]);
+	}
+}
+
+bool nddlgen::math::AxisAlignedBoundingBox::overlaps(const nddlgen::math::AxisAlignedBoundingBox& other) const
+{
+	// Boxes are disjoint as soon as they are separated on one of the three world axes
+	return this->_min[0] <= other._max[0] && other._min[0] <= this->_max[0]
+		&& this->_min[1] <= other._max[1] && other._min[1] <= this->_max[1]
+		&& this->_min[2] <= other._max[2] && other._min[2] <= this->_max[2];
+}
+
+double nddlgen::math::AxisAlignedBoundingBox::getMin(int axis) const
+{
+	return this->_min[axis];
+}
+
+double nddlgen::math::AxisAlignedBoundingBox::getMax(int axis) const
+{
+	return this->_max[axis];
+}
+
+double nddlgen::math::AxisAlignedBoundingBox::getCenter(int axis) const
+{
+	return (this->_min[axis] + this->_max[axis]) / 2;
+}
+
+int nddlgen::math::AxisAlignedBoundingBox::getLongestAxis() const
+{
+	int longestAxis = 0;
+
+	for (int axis = 1; axis < 3; axis++)
+	{
+		if (this->_max[axis] - this->_min[axis] > this->_max[longestAxis] - this->_min[longestAxis])
+		{
+			longestAxis = axis;
+		}
+	}
+
+	return longestAxis;
+}
@@ -0,0 +1,114 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_MATH_AXISALIGNEDBOUNDINGBOX_H_
+#define NDDLGEN_MATH_AXISALIGNEDBOUNDINGBOX_H_
+
+#include <limits>
+
+#include <nddlgen/math/Cuboid.h>
+#include <nddlgen/math/Trivial.h>
+
+namespace nddlgen
+{
+	namespace math
+	{
+		class AxisAlignedBoundingBox;
+	}
+}
+
+/**
+ * World space axis aligned bounding box. Used as a conservative bound of a cuboid
+ * to cheaply reject pairs of cuboids that can not intersect.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::math::AxisAlignedBoundingBox
+{
+
+	private:
+
+		/**
+		 * Minimum coordinates on the x, y and z axis.
+		 */
+		double _min[3];
+
+		/**
+		 * Maximum coordinates on the x, y and z axis.
+		 */
+		double _max[3];
+
+	public:
+
+		/**
+		 * Constructs an empty bounding box, which does not overlap with anything.
+		 */
+		AxisAlignedBoundingBox();
+
+		/**
+		 * Constructs a bounding box from its minimum and maximum coordinates.
+		 */
+		AxisAlignedBoundingBox(double minX, double minY, double minZ, double maxX, double maxY, double maxZ);
+
+		/**
+		 * Computes the tightest axis aligned bounding box enclosing all vertices of a cuboid.
+		 *
+		 * @param cuboid Cuboid to be enclosed
+		 *
+		 * @return Axis aligned bounding box of cuboid
+		 */
+		static nddlgen::math::AxisAlignedBoundingBox fromCuboid(nddlgen::math::CuboidPtr cuboid);
+
+		/**
+		 * Grows this bounding box so that it also encloses other.
+		 *
+		 * @param other Bounding box to be enclosed
+		 */
+		void expand(const nddlgen::math::AxisAlignedBoundingBox& other);
+
+		/**
+		 * Checks if this bounding box and other do overlap. Touching boxes are considered
+		 * to overlap, so that this test never rejects a pair the SAT test would accept.
+		 *
+		 * @param other Other bounding box
+		 *
+		 * @return True, if the bounding boxes overlap, false if not
+		 */
+		bool overlaps(const nddlgen::math::AxisAlignedBoundingBox& other) const;
+
+		/**
+		 * Gets the minimum coordinate on the given axis (0 = x, 1 = y, 2 = z).
+		 */
+		double getMin(int axis) const;
+
+		/**
+		 * Gets the maximum coordinate on the given axis (0 = x, 1 = y, 2 = z).
+		 */
+		double getMax(int axis) const;
+
+		/**
+		 * Gets the center coordinate on the given axis (0 = x, 1 = y, 2 = z).
+		 */
+		double getCenter(int axis) const;
+
+		/**
+		 * Gets the axis (0 = x, 1 = y, 2 = z) along which this bounding box has its largest extent.
+		 */
+		int getLongestAxis() const;
+
+};
+
+#endif
@@ -0,0 +1,198 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/math/BatchedSeparatingAxisTheoremTest.h>
+
+namespace
+{
+
+	// Thin wrappers, so that the kernel below is written once for all instruction sets
+
+#if defined(__AVX__)
+
+	typedef __m256d Lanes;
+
+	const int LANE_WIDTH = 4;
+
+	inline Lanes broadcast(double value) { return _mm256_set1_pd(value); }
+	inline Lanes load(const double* values) { return _mm256_loadu_pd(values); }
+	inline Lanes add(Lanes a, Lanes b) { return _mm256_add_pd(a, b); }
+	inline Lanes sub(Lanes a, Lanes b) { return _mm256_sub_pd(a, b); }
+	inline Lanes mul(Lanes a, Lanes b) { return _mm256_mul_pd(a, b); }
+	inline Lanes absolute(Lanes a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+	inline int greaterOrEqual(Lanes a, Lanes b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GE_OQ)); }
+
+#elif defined(__SSE2__)
+
+	typedef __m128d Lanes;
+
+	const int LANE_WIDTH = 2;
+
+	inline Lanes broadcast(double value) { return _mm_set1_pd(value); }
+	inline Lanes load(const double* values) { return _mm_loadu_pd(values); }
+	inline Lanes add(Lanes a, Lanes b) { return _mm_add_pd(a, b); }
+	inline Lanes sub(Lanes a, Lanes b) { return _mm_sub_pd(a, b); }
+	inline Lanes mul(Lanes a, Lanes b) { return _mm_mul_pd(a, b); }
+	inline Lanes absolute(Lanes a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+	inline int greaterOrEqual(Lanes a, Lanes b) { return _mm_movemask_pd(_mm_cmpge_pd(a, b)); }
+
+#else
+
+	typedef double Lanes;
+
+	const int LANE_WIDTH = 1;
+
+	inline Lanes broadcast(double value) { return value; }
+	inline Lanes load(const double* values) { return *values; }
+	inline Lanes add(Lanes a, Lanes b) { return a + b; }
+	inline Lanes sub(Lanes a, Lanes b) { return a - b; }
+	inline Lanes mul(Lanes a, Lanes b) { return a * b; }
+	inline Lanes absolute(Lanes a) { return std::fabs(a); }
+	inline int greaterOrEqual(Lanes a, Lanes b) { return (a >= b) ? 1 : 0; }
+
+#endif
+
+}
+
+nddlgen::math::BatchedSeparatingAxisTheoremTest::BatchedSeparatingAxisTheoremTest()
+{
+
+}
+
+nddlgen::math::BatchedSeparatingAxisTheoremTest::~BatchedSeparatingAxisTheoremTest()
+{
+
+}
+
+boost::uint64_t nddlgen::math::BatchedSeparatingAxisTheoremTest::doesIntersect(const nddlgen::math::Cuboid& box,
+		const nddlgen::math::CuboidBlock& block)
+{
+	// Lane wise counterpart of OrientedBoundingBoxTest::doesIntersect(), where box is box1 and
+	// each cuboid of the block is box2. All terms are expressed in the coordinate frame of box
+
+	boost::uint64_t hits = 0;
+	int allLanes = (1 << LANE_WIDTH) - 1;
+
+	Lanes extents1[3] = {
+			broadcast(box.getHalfExtents().x),
+			broadcast(box.getHalfExtents().y),
+			broadcast(box.getHalfExtents().z)
+	};
+	Lanes threshold = broadcast(nddlgen::math::OrientedBoundingBoxTest::DEGENERATE_AXIS_THRESHOLD);
+
+	// Process LANE_WIDTH cuboids of the block at once
+	for (int first = 0; first < block.getCount(); first += LANE_WIDTH)
+	{
+		Lanes extents2[3];
+		Lanes rotation[3][3];
+		Lanes absRotation[3][3];
+
+		for (int j = 0; j < 3; j++)
+		{
+			extents2[j] = load(block.getHalfExtents(j) + first);
+
+			Lanes x = load(block.getAxisCoordinates(j, 0) + first);
+			Lanes y = load(block.getAxisCoordinates(j, 1) + first);
+			Lanes z = load(block.getAxisCoordinates(j, 2) + first);
+
+			for (int i = 0; i < 3; i++)
+			{
+				const nddlgen::math::Vector3& axis1 = box.getAxis(i);
+
+				rotation[i][j] = add(add(mul(broadcast(axis1.x), x), mul(broadcast(axis1.y), y)),
+						mul(broadcast(axis1.z), z));
+				absRotation[i][j] = absolute(rotation[i][j]);
+			}
+		}
+
+		// Translation between the centers in the coordinate frame of box
+		Lanes dx = sub(load(block.getCenterCoordinates(0) + first), broadcast(box.getCenter().x));
+		Lanes dy = sub(load(block.getCenterCoordinates(1) + first), broadcast(box.getCenter().y));
+		Lanes dz = sub(load(block.getCenterCoordinates(2) + first), broadcast(box.getCenter().z));
+		Lanes translation[3];
+
+		for (int i = 0; i < 3; i++)
+		{
+			const nddlgen::math::Vector3& axis1 = box.getAxis(i);
+
+			translation[i] = add(add(mul(dx, broadcast(axis1.x)), mul(dy, broadcast(axis1.y))),
+					mul(dz, broadcast(axis1.z)));
+		}
+
+		// Lanes that were separated by at least one axis
+		int separated = 0;
+
+		// Face normals of box
+		for (int i = 0; i < 3; i++)
+		{
+			Lanes radius2 = add(add(mul(extents2[0], absRotation[i][0]), mul(extents2[1], absRotation[i][1])),
+					mul(extents2[2], absRotation[i][2]));
+
+			separated |= greaterOrEqual(absolute(translation[i]), add(extents1[i], radius2));
+		}
+
+		// Face normals of the cuboids in the block
+		for (int j = 0; j < 3 && separated != allLanes; j++)
+		{
+			Lanes radius1 = add(add(mul(extents1[0], absRotation[0][j]), mul(extents1[1], absRotation[1][j])),
+					mul(extents1[2], absRotation[2][j]));
+			Lanes distance = absolute(add(add(mul(translation[0], rotation[0][j]),
+					mul(translation[1], rotation[1][j])), mul(translation[2], rotation[2][j])));
+
+			separated |= greaterOrEqual(distance, add(radius1, extents2[j]));
+		}
+
+		// Cross products of each pair of face normals, unless they are degenerate
+		for (int i = 0; i < 3 && separated != allLanes; i++)
+		{
+			int i1 = (i + 1) % 3;
+			int i2 = (i + 2) % 3;
+
+			for (int j = 0; j < 3; j++)
+			{
+				int j1 = (j + 1) % 3;
+				int j2 = (j + 2) % 3;
+
+				Lanes squaredLength = add(mul(rotation[i1][j], rotation[i1][j]),
+						mul(rotation[i2][j], rotation[i2][j]));
+				Lanes radius1 = add(mul(extents1[i1], absRotation[i2][j]),
+						mul(extents1[i2], absRotation[i1][j]));
+				Lanes radius2 = add(mul(extents2[j1], absRotation[i][j2]),
+						mul(extents2[j2], absRotation[i][j1]));
+				Lanes distance = absolute(sub(mul(translation[i2], rotation[i1][j]),
+						mul(translation[i1], rotation[i2][j])));
+
+				separated |= greaterOrEqual(squaredLength, threshold)
+						& greaterOrEqual(distance, add(radius1, radius2));
+			}
+		}
+
+		hits |= ((boost::uint64_t) (~separated & allLanes)) << first;
+	}
+
+	// Discard lanes beyond the last cuboid of the block
+	if (block.getCount() < 64)
+	{
+		hits &= (((boost::uint64_t) 1) << block.getCount()) - 1;
+	}
+
+	return hits;
+}
+
+int nddlgen::math::BatchedSeparatingAxisTheoremTest::getLaneWidth()
+{
+	return LANE_WIDTH;
+}
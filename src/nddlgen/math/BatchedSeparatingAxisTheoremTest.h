@@ -0,0 +1,92 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_MATH_BATCHEDSEPARATINGAXISTHEOREMTEST_H_
+#define NDDLGEN_MATH_BATCHEDSEPARATINGAXISTHEOREMTEST_H_
+
+#include <cmath>
+
+#include <boost/cstdint.hpp>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <nddlgen/math/Cuboid.h>
+#include <nddlgen/math/CuboidBlock.h>
+#include <nddlgen/math/OrientedBoundingBoxTest.h>
+#include <nddlgen/math/Vector3.hpp>
+
+namespace nddlgen
+{
+	namespace math
+	{
+		class BatchedSeparatingAxisTheoremTest;
+	}
+}
+
+/**
+ * Batched implementation of the separating axis theorem (SAT) test. Tests one cuboid against
+ * a whole block of cuboids, testing the 15 axes for several cuboids of the block with one SIMD
+ * instruction. The instruction set is chosen at compile time: AVX (4 cuboids per
+ * instruction) if compiled with -mavx or -mavx2, SSE2 (2 cuboids per instruction) otherwise
+ * on x86, and a scalar fallback on all other platforms.
+ *
+ * The results are identical to nddlgen::math::OrientedBoundingBoxTest, since the same floating
+ * point operations are executed in the same order for every lane.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::math::BatchedSeparatingAxisTheoremTest
+{
+
+	private:
+
+		/**
+		 * Private constructor to prevent instantiation.
+		 */
+		BatchedSeparatingAxisTheoremTest();
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~BatchedSeparatingAxisTheoremTest();
+
+	public:
+
+		/**
+		 * Checks which cuboids of block intersect box by using the separating axis theorem.
+		 *
+		 * @param box Box to be tested
+		 * @param block Block of boxes box is tested against
+		 *
+		 * @return Bit mask of hits. Bit i is set, if box intersects the cuboid in lane i of block
+		 */
+		static boost::uint64_t doesIntersect(const nddlgen::math::Cuboid& box,
+				const nddlgen::math::CuboidBlock& block);
+
+		/**
+		 * Gets the amount of cuboids processed per instruction.
+		 *
+		 * @return Amount of SIMD lanes
+		 */
+		static int getLaneWidth();
+
+};
+
+#endif
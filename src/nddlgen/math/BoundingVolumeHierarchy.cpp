@@ -0,0 +1,185 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/math/BoundingVolumeHierarchy.h>
+
+nddlgen::math::BoundingVolumeHierarchy::CenterComparator::CenterComparator(
+		const std::vector<nddlgen::math::AxisAlignedBoundingBox>& boxes,
+		int axis) : _boxes(boxes), _axis(axis)
+{
+
+}
+
+bool nddlgen::math::BoundingVolumeHierarchy::CenterComparator::operator()(int a, int b) const
+{
+	return this->_boxes[a].getCenter(this->_axis) < this->_boxes[b].getCenter(this->_axis);
+}
+
+nddlgen::math::BoundingVolumeHierarchy::BoundingVolumeHierarchy()
+{
+
+}
+
+nddlgen::math::BoundingVolumeHierarchy::~BoundingVolumeHierarchy()
+{
+
+}
+
+void nddlgen::math::BoundingVolumeHierarchy::build(const std::vector<nddlgen::math::AxisAlignedBoundingBox>& boxes)
+{
+	this->_boxes = boxes;
+	this->_itemIndices.resize(boxes.size());
+	this->_itemLeaves.resize(boxes.size());
+	this->_nodes.clear();
+
+	for (int i = 0; i < (int) boxes.size(); i++)
+	{
+		this->_itemIndices[i] = i;
+	}
+
+	// A binary tree with n leafs has at most 2n - 1 nodes
+	this->_nodes.reserve(2 * boxes.size());
+
+	if (!boxes.empty())
+	{
+		this->buildNode(0, boxes.size(), -1);
+	}
+}
+
+int nddlgen::math::BoundingVolumeHierarchy::buildNode(int first, int count, int parent)
+{
+	Node node;
+	node.left = -1;
+	node.right = -1;
+	node.first = first;
+	node.count = count;
+	node.parent = parent;
+
+	// Bounds of the node enclose all items, the bounds of the centers determine the split axis
+	nddlgen::math::AxisAlignedBoundingBox centerBounds;
+
+	for (int i = first; i < first + count; i++)
+	{
+		const nddlgen::math::AxisAlignedBoundingBox& box = this->_boxes[this->_itemIndices[i]];
+
+		node.bounds.expand(box);
+		centerBounds.expand(nddlgen::math::AxisAlignedBoundingBox(box.getCenter(0), box.getCenter(1),
+				box.getCenter(2), box.getCenter(0), box.getCenter(1), box.getCenter(2)));
+	}
+
+	int nodeIndex = this->_nodes.size();
+	this->_nodes.push_back(node);
+
+	int axis = centerBounds.getLongestAxis();
+
+	// Small ranges, or ranges that can not be split since all centers coincide, become leafs
+	if (count <= BoundingVolumeHierarchy::LEAF_SIZE || centerBounds.getMax(axis) <= centerBounds.getMin(axis))
+	{
+		for (int i = first; i < first + count; i++)
+		{
+			this->_itemLeaves[this->_itemIndices[i]] = nodeIndex;
+		}
+
+		return nodeIndex;
+	}
+
+	// Split at the median center along the longest axis
+	int half = count / 2;
+
+	std::nth_element(this->_itemIndices.begin() + first, this->_itemIndices.begin() + first + half,
+			this->_itemIndices.begin() + first + count, CenterComparator(this->_boxes, axis));
+
+	int left = this->buildNode(first, half, nodeIndex);
+	int right = this->buildNode(first + half, count - half, nodeIndex);
+
+	// Not using a reference to the node above, since recursion may have reallocated _nodes
+	this->_nodes[nodeIndex].left = left;
+	this->_nodes[nodeIndex].right = right;
+	this->_nodes[nodeIndex].count = 0;
+
+	return nodeIndex;
+}
+
+void nddlgen::math::BoundingVolumeHierarchy::query(const nddlgen::math::AxisAlignedBoundingBox& box,
+		std::vector<int>& result) const
+{
+	if (this->_nodes.empty())
+	{
+		return;
+	}
+
+	std::vector<int> stack;
+	stack.push_back(0);
+
+	while (!stack.empty())
+	{
+		const Node& node = this->_nodes[stack.back()];
+		stack.pop_back();
+
+		// Prune whole subtree if its bounds do not overlap
+		if (!node.bounds.overlaps(box))
+		{
+			continue;
+		}
+
+		if (node.count > 0)
+		{
+			// Leaf. Test every item on its own
+			for (int i = node.first; i < node.first + node.count; i++)
+			{
+				if (this->_boxes[this->_itemIndices[i]].overlaps(box))
+				{
+					result.push_back(this->_itemIndices[i]);
+				}
+			}
+		}
+		else
+		{
+			stack.push_back(node.left);
+			stack.push_back(node.right);
+		}
+	}
+}
+
+void nddlgen::math::BoundingVolumeHierarchy::refit(int item, const nddlgen::math::AxisAlignedBoundingBox& box)
+{
+	this->_boxes[item] = box;
+
+	// Recompute the bounds of the leaf from its items
+	int nodeIndex = this->_itemLeaves[item];
+	Node& leaf = this->_nodes[nodeIndex];
+
+	leaf.bounds = nddlgen::math::AxisAlignedBoundingBox();
+
+	for (int i = leaf.first; i < leaf.first + leaf.count; i++)
+	{
+		leaf.bounds.expand(this->_boxes[this->_itemIndices[i]]);
+	}
+
+	// Recompute the bounds of all inner nodes above from their children
+	for (nodeIndex = leaf.parent; nodeIndex != -1; nodeIndex = this->_nodes[nodeIndex].parent)
+	{
+		Node& node = this->_nodes[nodeIndex];
+
+		node.bounds = this->_nodes[node.left].bounds;
+		node.bounds.expand(this->_nodes[node.right].bounds);
+	}
+}
+
+int nddlgen::math::BoundingVolumeHierarchy::getItemCount() const
+{
+	return this->_boxes.size();
+}
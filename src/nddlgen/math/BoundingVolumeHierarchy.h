@@ -0,0 +1,160 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_MATH_BOUNDINGVOLUMEHIERARCHY_H_
+#define NDDLGEN_MATH_BOUNDINGVOLUMEHIERARCHY_H_
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <nddlgen/math/AxisAlignedBoundingBox.h>
+
+namespace nddlgen
+{
+	namespace math
+	{
+		class BoundingVolumeHierarchy;
+		typedef boost::shared_ptr<nddlgen::math::BoundingVolumeHierarchy> BoundingVolumeHierarchyPtr;
+	}
+}
+
+/**
+ * Binary tree of axis aligned bounding boxes. Built top down by splitting the items at the
+ * median of their centers along the longest axis, so that a query only needs to descend into
+ * subtrees whose bounds overlap the query box.
+ *
+ * Boxes of single items can be changed afterwards by refitting the bounds of all nodes above
+ * them, without rebuilding the tree. Many refits degrade query performance, so the tree should
+ * be rebuilt if most of the items moved.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::math::BoundingVolumeHierarchy
+{
+
+	private:
+
+		/**
+		 * Maximum amount of items stored in a leaf.
+		 */
+		static const int LEAF_SIZE = 4;
+
+		/**
+		 * Node of the tree. Inner nodes reference their children, leafs reference a range
+		 * within _itemIndices.
+		 */
+		struct Node
+		{
+			nddlgen::math::AxisAlignedBoundingBox bounds;
+			int left;
+			int right;
+			int first;
+			int count;
+			int parent;
+		};
+
+		/**
+		 * Orders item indices by the center of their box along one axis.
+		 */
+		class CenterComparator
+		{
+			private:
+				const std::vector<nddlgen::math::AxisAlignedBoundingBox>& _boxes;
+				int _axis;
+			public:
+				CenterComparator(const std::vector<nddlgen::math::AxisAlignedBoundingBox>& boxes, int axis);
+				bool operator()(int a, int b) const;
+		};
+
+		/**
+		 * Boxes of all items, indexed by item index.
+		 */
+		std::vector<nddlgen::math::AxisAlignedBoundingBox> _boxes;
+
+		/**
+		 * Item indices, ordered so that every leaf references a consecutive range.
+		 */
+		std::vector<int> _itemIndices;
+
+		/**
+		 * All nodes of the tree. The root node is stored at index 0.
+		 */
+		std::vector<Node> _nodes;
+
+		/**
+		 * Leaf node of each item, indexed by item index.
+		 */
+		std::vector<int> _itemLeaves;
+
+		/**
+		 * Recursively builds the subtree holding the items in _itemIndices[first, first + count).
+		 *
+		 * @param first First position in _itemIndices
+		 * @param count Amount of items
+		 * @param parent Index of the parent node, or -1 for the root
+		 *
+		 * @return Index of the created node
+		 */
+		int buildNode(int first, int count, int parent);
+
+	public:
+
+		/**
+		 * Constructs an empty bounding volume hierarchy.
+		 */
+		BoundingVolumeHierarchy();
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~BoundingVolumeHierarchy();
+
+		/**
+		 * (Re-)builds the tree over the given boxes. Item indices correspond to the positions
+		 * within boxes.
+		 *
+		 * @param boxes Boxes of all items
+		 */
+		void build(const std::vector<nddlgen::math::AxisAlignedBoundingBox>& boxes);
+
+		/**
+		 * Finds all items whose box overlaps the given box.
+		 *
+		 * @param box Query box
+		 * @param result Vector the indices of all overlapping items are appended to (unordered)
+		 */
+		void query(const nddlgen::math::AxisAlignedBoundingBox& box, std::vector<int>& result) const;
+
+		/**
+		 * Changes the box of an item and updates the bounds of all nodes above it.
+		 *
+		 * @param item Item index
+		 * @param box New box of the item
+		 */
+		void refit(int item, const nddlgen::math::AxisAlignedBoundingBox& box);
+
+		/**
+		 * Gets the amount of items.
+		 *
+		 * @return Amount of items.
+		 */
+		int getItemCount() const;
+
+};
+
+#endif
@@ -0,0 +1,48 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/math/BoundingVolumeHierarchyBroadPhase.h>
+
+nddlgen::math::BoundingVolumeHierarchyBroadPhase::BoundingVolumeHierarchyBroadPhase()
+{
+
+}
+
+nddlgen::math::BoundingVolumeHierarchyBroadPhase::~BoundingVolumeHierarchyBroadPhase()
+{
+
+}
+
+nddlgen::math::CandidateList nddlgen::math::BoundingVolumeHierarchyBroadPhase::findCandidates(
+		const std::vector<nddlgen::math::AxisAlignedBoundingBox>& queryBoxes,
+		const std::vector<nddlgen::math::AxisAlignedBoundingBox>& targetBoxes)
+{
+	nddlgen::math::CandidateList candidates(queryBoxes.size());
+
+	// Build tree over all target boxes
+	nddlgen::math::BoundingVolumeHierarchy hierarchy;
+	hierarchy.build(targetBoxes);
+
+	// Query tree with every query box. Sort the result, so that the narrow phase runs in the
+	// same order as it would without pruning
+	for (int i = 0; i < (int) queryBoxes.size(); i++)
+	{
+		hierarchy.query(queryBoxes[i], candidates[i]);
+		std::sort(candidates[i].begin(), candidates[i].end());
+	}
+
+	return candidates;
+}
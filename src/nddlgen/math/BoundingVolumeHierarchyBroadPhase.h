@@ -0,0 +1,69 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_MATH_BOUNDINGVOLUMEHIERARCHYBROADPHASE_H_
+#define NDDLGEN_MATH_BOUNDINGVOLUMEHIERARCHYBROADPHASE_H_
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <nddlgen/math/AbstractBroadPhase.h>
+#include <nddlgen/math/BoundingVolumeHierarchy.h>
+
+namespace nddlgen
+{
+	namespace math
+	{
+		class BoundingVolumeHierarchyBroadPhase;
+		typedef boost::shared_ptr<nddlgen::math::BoundingVolumeHierarchyBroadPhase> BoundingVolumeHierarchyBroadPhasePtr;
+	}
+}
+
+/**
+ * Broad phase building a bounding volume hierarchy over the target boxes. Each query box only
+ * visits the parts of the tree it overlaps, so the runtime grows with the amount of actual
+ * neighbours instead of the amount of all pairs.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::math::BoundingVolumeHierarchyBroadPhase : public nddlgen::math::AbstractBroadPhase
+{
+
+	public:
+
+		/**
+		 * Constructs a new bounding volume hierarchy broad phase.
+		 */
+		BoundingVolumeHierarchyBroadPhase();
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~BoundingVolumeHierarchyBroadPhase();
+
+		/**
+		 * @see nddlgen::math::AbstractBroadPhase::findCandidates
+		 */
+		virtual nddlgen::math::CandidateList findCandidates(
+				const std::vector<nddlgen::math::AxisAlignedBoundingBox>& queryBoxes,
+				const std::vector<nddlgen::math::AxisAlignedBoundingBox>& targetBoxes
+		);
+
+};
+
+#endif
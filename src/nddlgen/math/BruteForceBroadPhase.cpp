@@ -0,0 +1,43 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/math/BruteForceBroadPhase.h>
+
+nddlgen::math::BruteForceBroadPhase::BruteForceBroadPhase()
+{
+
+}
+
+nddlgen::math::BruteForceBroadPhase::~BruteForceBroadPhase()
+{
+
+}
+
+nddlgen::math::CandidateList nddlgen::math::BruteForceBroadPhase::findCandidates(
+		const std::vector<nddlgen::math::AxisAlignedBoundingBox>& queryBoxes,
+		const std::vector<nddlgen::math::AxisAlignedBoundingBox>& targetBoxes)
+{
+	// All target indices, in ascending order
+	std::vector<int> allTargets(targetBoxes.size());
+
+	for (int i = 0; i < (int) targetBoxes.size(); i++)
+	{
+		allTargets[i] = i;
+	}
+
+	// Every query box is paired with every target box
+	return nddlgen::math::CandidateList(queryBoxes.size(), allTargets);
+}
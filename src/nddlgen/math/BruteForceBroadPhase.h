@@ -0,0 +1,66 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_MATH_BRUTEFORCEBROADPHASE_H_
+#define NDDLGEN_MATH_BRUTEFORCEBROADPHASE_H_
+
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <nddlgen/math/AbstractBroadPhase.h>
+
+namespace nddlgen
+{
+	namespace math
+	{
+		class BruteForceBroadPhase;
+		typedef boost::shared_ptr<nddlgen::math::BruteForceBroadPhase> BruteForceBroadPhasePtr;
+	}
+}
+
+/**
+ * Broad phase without any pruning. Every target box is a candidate for every query box,
+ * so that each permutation is handed to the narrow phase.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::math::BruteForceBroadPhase : public nddlgen::math::AbstractBroadPhase
+{
+
+	public:
+
+		/**
+		 * Constructs a new brute force broad phase.
+		 */
+		BruteForceBroadPhase();
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~BruteForceBroadPhase();
+
+		/**
+		 * @see nddlgen::math::AbstractBroadPhase::findCandidates
+		 */
+		virtual nddlgen::math::CandidateList findCandidates(
+				const std::vector<nddlgen::math::AxisAlignedBoundingBox>& queryBoxes,
+				const std::vector<nddlgen::math::AxisAlignedBoundingBox>& targetBoxes
+		);
+
+};
+
+#endif
@@ -16,6 +16,31 @@
 
 #include <nddlgen/math/Cuboid.h>
 
+nddlgen::math::Cuboid::Cuboid(const nddlgen::math::Vector3& center,
+		const nddlgen::math::Vector3& halfExtents,
+		const nddlgen::math::Vector3 (&axes)[3])
+{
+	this->_center = center;
+	this->_halfExtents = halfExtents;
+
+	for (int axis = 0; axis < 3; axis++)
+	{
+		this->_axes[axis] = axes[axis];
+	}
+
+	this->computeVertices();
+	this->computeBounds();
+}
+
+nddlgen::math::Cuboid::Cuboid(const nddlgen::math::Vector3 (&vertices)[8],
+		const nddlgen::math::Vector3& normalXAxis,
+		const nddlgen::math::Vector3& normalYAxis,
+		const nddlgen::math::Vector3& normalZAxis)
+{
+	this->initFromVertices(vertices, normalXAxis, normalYAxis, normalZAxis);
+	this->computeBounds();
+}
+
 nddlgen::math::Cuboid::Cuboid(std::vector<nddlgen::math::VectorPtr> vertices,
 		nddlgen::math::VectorPtr normalXAxis,
 		nddlgen::math::VectorPtr normalYAxis,
@@ -26,10 +51,15 @@ nddlgen::math::Cuboid::Cuboid(std::vector<nddlgen::math::VectorPtr> vertices,
 		throw nddlgen::exceptions::CuboidInstantiationException();
 	}
 
-	this->_vertices = vertices;
-	this->_normalXAxis = normalXAxis;
-	this->_normalYAxis = normalYAxis;
-	this->_normalZAxis = normalZAxis;
+	nddlgen::math::Vector3 values[8];
+
+	for (int i = 0; i < 8 /* amount of vertices of a cuboid */; i++)
+	{
+		values[i] = vertices[i]->getValue();
+	}
+
+	this->initFromVertices(values, normalXAxis->getValue(), normalYAxis->getValue(), normalZAxis->getValue());
+	this->computeBounds();
 }
 
 nddlgen::math::Cuboid::~Cuboid()
@@ -37,22 +67,134 @@ nddlgen::math::Cuboid::~Cuboid()
 
 }
 
-nddlgen::math::VectorPtr nddlgen::math::Cuboid::getVertex(int index)
+nddlgen::math::VectorPtr nddlgen::math::Cuboid::getVertex(int index) const
+{
+	if (index < 0 || index >= 8)
+	{
+		throw std::out_of_range("Cuboid vertex index out of range.");
+	}
+
+	nddlgen::math::VectorPtr vertex(new nddlgen::math::Vector(this->getVertexValue(index)));
+	return vertex;
+}
+
+nddlgen::math::VectorPtr nddlgen::math::Cuboid::getNormalXAxis() const
 {
-	return this->_vertices.at(index);
+	nddlgen::math::VectorPtr normal(new nddlgen::math::Vector(this->_axes[0]));
+	return normal;
 }
 
-nddlgen::math::VectorPtr nddlgen::math::Cuboid::getNormalXAxis()
+nddlgen::math::VectorPtr nddlgen::math::Cuboid::getNormalYAxis() const
 {
-	return this->_normalXAxis;
+	nddlgen::math::VectorPtr normal(new nddlgen::math::Vector(this->_axes[1]));
+	return normal;
 }
 
-nddlgen::math::VectorPtr nddlgen::math::Cuboid::getNormalYAxis()
+nddlgen::math::VectorPtr nddlgen::math::Cuboid::getNormalZAxis() const
 {
-	return this->_normalYAxis;
+	nddlgen::math::VectorPtr normal(new nddlgen::math::Vector(this->_axes[2]));
+	return normal;
 }
 
-nddlgen::math::VectorPtr nddlgen::math::Cuboid::getNormalZAxis()
+void nddlgen::math::Cuboid::initFromVertices(const nddlgen::math::Vector3* vertices,
+		const nddlgen::math::Vector3& normalXAxis,
+		const nddlgen::math::Vector3& normalYAxis,
+		const nddlgen::math::Vector3& normalZAxis)
 {
-	return this->_normalZAxis;
+	// Keep the given vertices as vertex form
+	nddlgen::math::Vector3 center = { 0, 0, 0 };
+
+	for (int i = 0; i < 8 /* amount of vertices of a cuboid */; i++)
+	{
+		this->_vertices[i] = vertices[i];
+
+		center.x += vertices[i].x / 8;
+		center.y += vertices[i].y / 8;
+		center.z += vertices[i].z / 8;
+	}
+
+	this->_center = center;
+	this->_axes[0] = normalXAxis;
+	this->_axes[1] = normalYAxis;
+	this->_axes[2] = normalZAxis;
+
+	double halfExtents[3] = { 0, 0, 0 };
+
+	for (int axis = 0; axis < 3; axis++)
+	{
+		nddlgen::math::Vector3& a = this->_axes[axis];
+		double length = std::sqrt(a.x * a.x + a.y * a.y + a.z * a.z);
+
+		// A null normal can only stem from a degenerated cuboid, which has no extent on this axis
+		if (length == 0)
+		{
+			continue;
+		}
+
+		a.x /= length;
+		a.y /= length;
+		a.z /= length;
+
+		// The half extent is the largest distance of a vertex to the center along this axis
+		for (int i = 0; i < 8 /* amount of vertices of a cuboid */; i++)
+		{
+			double distance = std::fabs((vertices[i].x - center.x) * a.x + (vertices[i].y - center.y) * a.y
+					+ (vertices[i].z - center.z) * a.z);
+
+			if (distance > halfExtents[axis])
+			{
+				halfExtents[axis] = distance;
+			}
+		}
+	}
+
+	this->_halfExtents.x = halfExtents[0];
+	this->_halfExtents.y = halfExtents[1];
+	this->_halfExtents.z = halfExtents[2];
+}
+
+void nddlgen::math::Cuboid::computeVertices()
+{
+	// Signs of the half extents for every vertex, in the same order as they were always constructed
+	static const double signs[8][3] = {
+			{  1,  1,  1 },
+			{  1, -1,  1 },
+			{ -1,  1,  1 },
+			{ -1, -1,  1 },
+			{  1,  1, -1 },
+			{  1, -1, -1 },
+			{ -1,  1, -1 },
+			{ -1, -1, -1 }
+	};
+
+	for (int i = 0; i < 8 /* amount of vertices of a cuboid */; i++)
+	{
+		double x = signs[i][0] * this->_halfExtents.x;
+		double y = signs[i][1] * this->_halfExtents.y;
+		double z = signs[i][2] * this->_halfExtents.z;
+
+		this->_vertices[i].x = this->_center.x + x * this->_axes[0].x + y * this->_axes[1].x + z * this->_axes[2].x;
+		this->_vertices[i].y = this->_center.y + x * this->_axes[0].y + y * this->_axes[1].y + z * this->_axes[2].y;
+		this->_vertices[i].z = this->_center.z + x * this->_axes[0].z + y * this->_axes[1].z + z * this->_axes[2].z;
+	}
+}
+
+void nddlgen::math::Cuboid::computeBounds()
+{
+	// The extent along a world axis is the sum of the projected half extents of all local axes
+	double extents[3] = {
+			std::fabs(this->_axes[0].x) * this->_halfExtents.x + std::fabs(this->_axes[1].x) * this->_halfExtents.y
+					+ std::fabs(this->_axes[2].x) * this->_halfExtents.z,
+			std::fabs(this->_axes[0].y) * this->_halfExtents.x + std::fabs(this->_axes[1].y) * this->_halfExtents.y
+					+ std::fabs(this->_axes[2].y) * this->_halfExtents.z,
+			std::fabs(this->_axes[0].z) * this->_halfExtents.x + std::fabs(this->_axes[1].z) * this->_halfExtents.y
+					+ std::fabs(this->_axes[2].z) * this->_halfExtents.z
+	};
+	double center[3] = { this->_center.x, this->_center.y, this->_center.z };
+
+	for (int axis = 0; axis < 3; axis++)
+	{
+		this->_minimum[axis] = center[axis] - extents[axis];
+		this->_maximum[axis] = center[axis] + extents[axis];
+	}
 }
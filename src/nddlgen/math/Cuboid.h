@@ -17,11 +17,14 @@
 #ifndef NDDLGEN_MATH_ORIENTEDBOUNDINGBOX_H_
 #define NDDLGEN_MATH_ORIENTEDBOUNDINGBOX_H_
 
+#include <cmath>
+#include <stdexcept>
 #include <vector>
 
 #include <boost/shared_ptr.hpp>
 
 #include <nddlgen/math/Vector.h>
+#include <nddlgen/math/Vector3.hpp>
 #include <nddlgen/exceptions/CuboidInstantiationException.hpp>
 
 namespace nddlgen
@@ -33,29 +36,158 @@ namespace nddlgen
 	}
 }
 
+/**
+ * Oriented cuboid in closed form: its center, the half extents along its three local axes and
+ * the orientation of these axes (the columns of its rotation matrix), which are unit vectors.
+ * Collision tests only need this compact form. The 8 vertices are kept as well, either as
+ * given on construction or computed from the closed form, so a cuboid is never modified after
+ * construction and can be read by several threads at once.
+ *
+ * @author Christian Dreher
+ */
 class nddlgen::math::Cuboid
 {
 
 	private:
 
-		std::vector<nddlgen::math::VectorPtr> _vertices;
-		nddlgen::math::VectorPtr _normalXAxis;
-		nddlgen::math::VectorPtr _normalYAxis;
-		nddlgen::math::VectorPtr _normalZAxis;
+		nddlgen::math::Vector3 _center;
+		nddlgen::math::Vector3 _halfExtents;
+		nddlgen::math::Vector3 _axes[3];
+
+		/**
+		 * World space axis aligned bounds, computed once on construction.
+		 */
+		double _minimum[3];
+		double _maximum[3];
+
+		/**
+		 * Vertex form.
+		 */
+		nddlgen::math::Vector3 _vertices[8];
+
+		/**
+		 * Derives the closed form from the vertices and the (not necessarily normalized) normals
+		 * of the axes.
+		 */
+		void initFromVertices(const nddlgen::math::Vector3* vertices,
+				const nddlgen::math::Vector3& normalXAxis,
+				const nddlgen::math::Vector3& normalYAxis,
+				const nddlgen::math::Vector3& normalZAxis);
+
+		/**
+		 * Computes the vertex form from the closed form.
+		 */
+		void computeVertices();
+
+		/**
+		 * Computes the world space axis aligned bounds from the closed form.
+		 */
+		void computeBounds();
 
 	public:
 
+		/**
+		 * Constructs a new cuboid in closed form.
+		 *
+		 * @param center Center of the cuboid
+		 * @param halfExtents Half of the size of the cuboid along each of its axes
+		 * @param axes Unit vectors of the local x, y and z axis (columns of the rotation matrix)
+		 */
+		Cuboid(const nddlgen::math::Vector3& center,
+				const nddlgen::math::Vector3& halfExtents,
+				const nddlgen::math::Vector3 (&axes)[3]);
+		Cuboid(const nddlgen::math::Vector3 (&vertices)[8],
+				const nddlgen::math::Vector3& normalXAxis,
+				const nddlgen::math::Vector3& normalYAxis,
+				const nddlgen::math::Vector3& normalZAxis);
+
+		/**
+		 * Constructs a new cuboid from its vertices and normals. The values of the given vectors
+		 * are copied, so modifying them afterwards does not modify the cuboid.
+		 */
 		Cuboid(std::vector<nddlgen::math::VectorPtr> vertices,
 				nddlgen::math::VectorPtr normalXAxis,
 				nddlgen::math::VectorPtr normalYAxis,
 				nddlgen::math::VectorPtr normalZAxis);
 		virtual ~Cuboid();
 
-		nddlgen::math::VectorPtr getVertex(int index);
-		nddlgen::math::VectorPtr getNormalXAxis();
-		nddlgen::math::VectorPtr getNormalYAxis();
-		nddlgen::math::VectorPtr getNormalZAxis();
+		const nddlgen::math::Vector3& getCenter() const;
+		const nddlgen::math::Vector3& getHalfExtents() const;
+		double getHalfExtent(int axis) const;
+		const nddlgen::math::Vector3& getAxis(int axis) const;
+
+		double getMinimum(int axis) const;
+		double getMaximum(int axis) const;
+
+		/**
+		 * Tests if the world space axis aligned bounds of this and another cuboid overlap. This
+		 * is a necessary condition for the cuboids to intersect and takes six comparisons.
+		 *
+		 * @param other Other cuboid
+		 *
+		 * @return True, if the bounds overlap (touching included), false if not.
+		 */
+		bool doBoundsOverlap(const nddlgen::math::Cuboid& other) const;
+
+		const nddlgen::math::Vector3& getVertexValue(int index) const;
+		const nddlgen::math::Vector3& getNormalValue(int axis) const;
+
+		/**
+		 * Deprecated, use getVertexValue() and getNormalValue() instead. These return newly
+		 * allocated copies, so writing to the returned vectors has no effect on the cuboid.
+		 */
+		nddlgen::math::VectorPtr getVertex(int index) const;
+		nddlgen::math::VectorPtr getNormalXAxis() const;
+		nddlgen::math::VectorPtr getNormalYAxis() const;
+		nddlgen::math::VectorPtr getNormalZAxis() const;
 
 };
 
+inline const nddlgen::math::Vector3& nddlgen::math::Cuboid::getCenter() const
+{
+	return this->_center;
+}
+
+inline const nddlgen::math::Vector3& nddlgen::math::Cuboid::getHalfExtents() const
+{
+	return this->_halfExtents;
+}
+
+inline double nddlgen::math::Cuboid::getHalfExtent(int axis) const
+{
+	return (axis == 0) ? this->_halfExtents.x : ((axis == 1) ? this->_halfExtents.y : this->_halfExtents.z);
+}
+
+inline const nddlgen::math::Vector3& nddlgen::math::Cuboid::getAxis(int axis) const
+{
+	return this->_axes[axis];
+}
+
+inline double nddlgen::math::Cuboid::getMinimum(int axis) const
+{
+	return this->_minimum[axis];
+}
+
+inline double nddlgen::math::Cuboid::getMaximum(int axis) const
+{
+	return this->_maximum[axis];
+}
+
+inline bool nddlgen::math::Cuboid::doBoundsOverlap(const nddlgen::math::Cuboid& other) const
+{
+	return this->_minimum[0] <= other._maximum[0] && other._minimum[0] <= this->_maximum[0]
+			&& this->_minimum[1] <= other._maximum[1] && other._minimum[1] <= this->_maximum[1]
+			&& this->_minimum[2] <= other._maximum[2] && other._minimum[2] <= this->_maximum[2];
+}
+
+inline const nddlgen::math::Vector3& nddlgen::math::Cuboid::getVertexValue(int index) const
+{
+	return this->_vertices[index];
+}
+
+inline const nddlgen::math::Vector3& nddlgen::math::Cuboid::getNormalValue(int axis) const
+{
+	return this->_axes[axis];
+}
+
 #endif
@@ -0,0 +1,101 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/math/CuboidBlock.h>
+
+nddlgen::math::CuboidBlock::CuboidBlock()
+{
+	this->_count = 0;
+
+	// Zero all lanes once, so that lanes which were never filled hold valid values when processed
+	std::memset(this->_centers, 0, sizeof(this->_centers));
+	std::memset(this->_halfExtents, 0, sizeof(this->_halfExtents));
+	std::memset(this->_axes, 0, sizeof(this->_axes));
+	std::memset(this->_minimum, 0, sizeof(this->_minimum));
+	std::memset(this->_maximum, 0, sizeof(this->_maximum));
+}
+
+nddlgen::math::CuboidBlock::~CuboidBlock()
+{
+
+}
+
+void nddlgen::math::CuboidBlock::clear()
+{
+	// Lanes are overwritten when cuboids are added again, so there is no need to zero them
+	this->_count = 0;
+}
+
+int nddlgen::math::CuboidBlock::add(const nddlgen::math::Cuboid& cuboid)
+{
+	int lane = this->_count;
+
+	const nddlgen::math::Vector3& center = cuboid.getCenter();
+
+	this->_centers[0][lane] = center.x;
+	this->_centers[1][lane] = center.y;
+	this->_centers[2][lane] = center.z;
+
+	for (int axis = 0; axis < 3; axis++)
+	{
+		const nddlgen::math::Vector3& direction = cuboid.getAxis(axis);
+
+		this->_halfExtents[axis][lane] = cuboid.getHalfExtent(axis);
+		this->_axes[axis][0][lane] = direction.x;
+		this->_axes[axis][1][lane] = direction.y;
+		this->_axes[axis][2][lane] = direction.z;
+
+		this->_minimum[axis][lane] = cuboid.getMinimum(axis);
+		this->_maximum[axis][lane] = cuboid.getMaximum(axis);
+	}
+
+	this->_count++;
+
+	return lane;
+}
+
+int nddlgen::math::CuboidBlock::getCount() const
+{
+	return this->_count;
+}
+
+bool nddlgen::math::CuboidBlock::isFull() const
+{
+	return this->_count >= CuboidBlock::CAPACITY;
+}
+
+boost::uint64_t nddlgen::math::CuboidBlock::findOverlappingBounds(const nddlgen::math::Cuboid& cuboid) const
+{
+	boost::uint64_t overlapping = 0;
+
+	for (int lane = 0; lane < this->_count; lane++)
+	{
+		bool overlaps = true;
+
+		for (int axis = 0; axis < 3 && overlaps; axis++)
+		{
+			overlaps = this->_minimum[axis][lane] <= cuboid.getMaximum(axis)
+					&& cuboid.getMinimum(axis) <= this->_maximum[axis][lane];
+		}
+
+		if (overlaps)
+		{
+			overlapping |= ((boost::uint64_t) 1) << lane;
+		}
+	}
+
+	return overlapping;
+}
@@ -0,0 +1,182 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_MATH_CUBOIDBLOCK_H_
+#define NDDLGEN_MATH_CUBOIDBLOCK_H_
+
+#include <cstring>
+
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <nddlgen/math/Cuboid.h>
+#include <nddlgen/math/Vector3.hpp>
+
+namespace nddlgen
+{
+	namespace math
+	{
+		class CuboidBlock;
+		typedef boost::shared_ptr<nddlgen::math::CuboidBlock> CuboidBlockPtr;
+	}
+}
+
+/**
+ * Block of up to CAPACITY cuboids in closed form stored as structure of arrays: for every
+ * coordinate of the center, every half extent and every coordinate of every axis, the values of
+ * all cuboids are stored consecutively. This allows to process
+ * several cuboids with one SIMD instruction. Cuboids are addressed by their lane, which is the
+ * position they were added at.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::math::CuboidBlock
+{
+
+	public:
+
+		/**
+		 * Maximum amount of cuboids within one block. Equals the amount of bits of a hit mask.
+		 */
+		static const int CAPACITY = 64;
+
+	private:
+
+		/**
+		 * Amount of cuboids within this block.
+		 */
+		int _count;
+
+		/**
+		 * Center coordinates, indexed by coordinate (0 = x, 1 = y, 2 = z) and lane.
+		 */
+		double _centers[3][CAPACITY];
+
+		/**
+		 * Half extents, indexed by local axis and lane.
+		 */
+		double _halfExtents[3][CAPACITY];
+
+		/**
+		 * Axis coordinates, indexed by local axis, coordinate (0 = x, 1 = y, 2 = z) and lane.
+		 */
+		double _axes[3][3][CAPACITY];
+
+		/**
+		 * World space axis aligned bounds, indexed by world axis and lane.
+		 */
+		double _minimum[3][CAPACITY];
+		double _maximum[3][CAPACITY];
+
+	public:
+
+		/**
+		 * Constructs an empty block.
+		 */
+		CuboidBlock();
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~CuboidBlock();
+
+		/**
+		 * Removes all cuboids from this block.
+		 */
+		void clear();
+
+		/**
+		 * Adds a cuboid to the next free lane. Must not be called if the block is full.
+		 *
+		 * @param cuboid Cuboid to be added
+		 *
+		 * @return Lane of the added cuboid
+		 */
+		int add(const nddlgen::math::Cuboid& cuboid);
+
+		/**
+		 * Gets the amount of cuboids within this block.
+		 *
+		 * @return Amount of cuboids.
+		 */
+		int getCount() const;
+
+		/**
+		 * Tests if no more cuboids can be added.
+		 *
+		 * @return True, if the block is full, false if not.
+		 */
+		bool isFull() const;
+
+		/**
+		 * Finds the cuboids of this block whose world space axis aligned bounds overlap the
+		 * bounds of another cuboid.
+		 *
+		 * @param cuboid Other cuboid
+		 *
+		 * @return Bit mask of lanes whose bounds overlap (touching included)
+		 */
+		boost::uint64_t findOverlappingBounds(const nddlgen::math::Cuboid& cuboid) const;
+
+		/**
+		 * Gets one coordinate of the centers of all cuboids, starting at lane 0. Lanes beyond
+		 * getCount() hold stale, but finite values and must be ignored.
+		 *
+		 * @param coordinate Coordinate (0 = x, 1 = y, 2 = z)
+		 *
+		 * @return Pointer to CAPACITY consecutive coordinates
+		 */
+		const double* getCenterCoordinates(int coordinate) const;
+
+		/**
+		 * Gets the half extents of all cuboids along one of their axes, starting at lane 0.
+		 * Lanes beyond getCount() hold stale, but finite values and must be ignored.
+		 *
+		 * @param axis Local axis (0 = x, 1 = y, 2 = z)
+		 *
+		 * @return Pointer to CAPACITY consecutive half extents
+		 */
+		const double* getHalfExtents(int axis) const;
+
+		/**
+		 * Gets one coordinate of one axis of all cuboids, starting at lane 0. Lanes beyond
+		 * getCount() hold stale, but finite values and must be ignored.
+		 *
+		 * @param axis Local axis (0 = x, 1 = y, 2 = z)
+		 * @param coordinate Coordinate (0 = x, 1 = y, 2 = z)
+		 *
+		 * @return Pointer to CAPACITY consecutive coordinates
+		 */
+		const double* getAxisCoordinates(int axis, int coordinate) const;
+
+};
+
+inline const double* nddlgen::math::CuboidBlock::getCenterCoordinates(int coordinate) const
+{
+	return this->_centers[coordinate];
+}
+
+inline const double* nddlgen::math::CuboidBlock::getHalfExtents(int axis) const
+{
+	return this->_halfExtents[axis];
+}
+
+inline const double* nddlgen::math::CuboidBlock::getAxisCoordinates(int axis, int coordinate) const
+{
+	return this->_axes[axis][coordinate];
+}
+
+#endif
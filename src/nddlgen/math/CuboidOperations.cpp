@@ -26,68 +26,92 @@ nddlgen::math::CuboidOperations::~CuboidOperations()
 
 }
 
-void nddlgen::math::CuboidOperations::roll(std::vector<nddlgen::math::VectorPtr> vertices, double angle)
+void nddlgen::math::CuboidOperations::roll(nddlgen::math::Vector3* vectors, int count, double angle)
 {
 	angle *= - 1; // Invert angle since roll/pitch/yaw are considered to be counter-clockwise, while angles are clockwise
 
 	double sinAngle = std::sin(angle);
 	double cosAngle = std::cos(angle);
 
-	for (int i = 0; i < 8 /* amount of vertices of a cuboid */; i++)
+	for (int i = 0; i < count; i++)
 	{
-		VectorPtr vector = vertices[i];
-
-		double y = vector->getY();
-		double z = vector->getZ();
+		double y = vectors[i].y;
+		double z = vectors[i].z;
 
-		double rotatedY = y * cosAngle - z * sinAngle;
-		double rotatedZ = z * cosAngle + y * sinAngle;
-
-		vector->setY(rotatedY);
-		vector->setZ(rotatedZ);
+		vectors[i].y = y * cosAngle - z * sinAngle;
+		vectors[i].z = z * cosAngle + y * sinAngle;
 	}
 }
 
-void nddlgen::math::CuboidOperations::pitch(std::vector<nddlgen::math::VectorPtr> vertices, double angle)
+void nddlgen::math::CuboidOperations::pitch(nddlgen::math::Vector3* vectors, int count, double angle)
 {
 	angle *= - 1; // Invert angle since roll/pitch/yaw are considered to be counter-clockwise, while angles are clockwise
 
 	double sinAngle = std::sin(angle);
 	double cosAngle = std::cos(angle);
 
-	for (int i = 0; i < 8 /* amount of vertices of a cuboid */; i++)
+	for (int i = 0; i < count; i++)
 	{
-		VectorPtr vector = vertices[i];
+		double x = vectors[i].x;
+		double z = vectors[i].z;
 
-		double x = vector->getX();
-		double z = vector->getZ();
-
-		double rotatedX = x * cosAngle - z * sinAngle;
-		double rotatedZ = z * cosAngle + x * sinAngle;
-
-		vector->setX(rotatedX);
-		vector->setZ(rotatedZ);
+		vectors[i].x = x * cosAngle - z * sinAngle;
+		vectors[i].z = z * cosAngle + x * sinAngle;
 	}
 }
 
-void nddlgen::math::CuboidOperations::yaw(std::vector<nddlgen::math::VectorPtr> vertices, double angle)
+void nddlgen::math::CuboidOperations::yaw(nddlgen::math::Vector3* vectors, int count, double angle)
 {
 	angle *= - 1; // Invert angle since roll/pitch/yaw are considered to be counter-clockwise, while angles are clockwise
 
 	double sinAngle = std::sin(angle);
 	double cosAngle = std::cos(angle);
 
-	for (int i = 0; i < 8 /* amount of vertices of a cuboid */; i++)
+	for (int i = 0; i < count; i++)
 	{
-		VectorPtr vector = vertices[i];
+		double x = vectors[i].x;
+		double y = vectors[i].y;
 
-		double x = vector->getX();
-		double y = vector->getY();
+		vectors[i].x = x * cosAngle - y * sinAngle;
+		vectors[i].y = y * cosAngle + x * sinAngle;
+	}
+}
 
-		double rotatedX = x * cosAngle - y * sinAngle;
-		double rotatedY = y * cosAngle + x * sinAngle;
+void nddlgen::math::CuboidOperations::roll(std::vector<nddlgen::math::VectorPtr> vertices, double angle)
+{
+	CuboidOperations::applyToVectors(vertices, angle, &CuboidOperations::roll);
+}
 
-		vector->setX(rotatedX);
-		vector->setY(rotatedY);
+void nddlgen::math::CuboidOperations::pitch(std::vector<nddlgen::math::VectorPtr> vertices, double angle)
+{
+	CuboidOperations::applyToVectors(vertices, angle, &CuboidOperations::pitch);
+}
+
+void nddlgen::math::CuboidOperations::yaw(std::vector<nddlgen::math::VectorPtr> vertices, double angle)
+{
+	CuboidOperations::applyToVectors(vertices, angle, &CuboidOperations::yaw);
+}
+
+void nddlgen::math::CuboidOperations::applyToVectors(std::vector<nddlgen::math::VectorPtr>& vertices, double angle,
+		void (*operation)(nddlgen::math::Vector3*, int, double))
+{
+	std::vector<nddlgen::math::Vector3> values(vertices.size());
+
+	for (int i = 0; i < (int) vertices.size(); i++)
+	{
+		values[i] = vertices[i]->getValue();
+	}
+
+	if (!values.empty())
+	{
+		operation(&values[0], values.size(), angle);
+	}
+
+	// Vertices are shared pointers, so writing back modifies the caller's vectors
+	for (int i = 0; i < (int) vertices.size(); i++)
+	{
+		vertices[i]->setX(values[i].x);
+		vertices[i]->setY(values[i].y);
+		vertices[i]->setZ(values[i].z);
 	}
 }
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include <nddlgen/math/Vector.h>
+#include <nddlgen/math/Vector3.hpp>
 
 namespace nddlgen
 {
@@ -38,8 +39,19 @@ class nddlgen::math::CuboidOperations
 		CuboidOperations();
 		virtual ~CuboidOperations();
 
+		/**
+		 * Helper for the compatibility overloads. Copies the vectors into values, applies
+		 * operation and writes the result back.
+		 */
+		static void applyToVectors(std::vector<nddlgen::math::VectorPtr>& vertices, double angle,
+				void (*operation)(nddlgen::math::Vector3*, int, double));
+
 	public:
 
+		static void roll(nddlgen::math::Vector3* vectors, int count, double angle);
+		static void pitch(nddlgen::math::Vector3* vectors, int count, double angle);
+		static void yaw(nddlgen::math::Vector3* vectors, int count, double angle);
+
 		static void roll(std::vector<nddlgen::math::VectorPtr> vertices, double angle);
 		static void pitch(std::vector<nddlgen::math::VectorPtr> vertices, double angle);
 		static void yaw(std::vector<nddlgen::math::VectorPtr> vertices, double angle);
@@ -0,0 +1,132 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/math/OrientedBoundingBoxTest.h>
+
+const double nddlgen::math::OrientedBoundingBoxTest::DEGENERATE_AXIS_THRESHOLD = 1e-12;
+
+nddlgen::math::OrientedBoundingBoxTest::OrientedBoundingBoxTest()
+{
+
+}
+
+nddlgen::math::OrientedBoundingBoxTest::~OrientedBoundingBoxTest()
+{
+
+}
+
+bool nddlgen::math::OrientedBoundingBoxTest::doesIntersect(const nddlgen::math::Cuboid& box1,
+		const nddlgen::math::Cuboid& box2)
+{
+	// All terms are expressed in the coordinate frame of box1. Note that
+	// BatchedSeparatingAxisTheoremTest executes the very same operations in the same order,
+	// so both must be changed together
+
+	double extents1[3] = { box1.getHalfExtents().x, box1.getHalfExtents().y, box1.getHalfExtents().z };
+	double extents2[3] = { box2.getHalfExtents().x, box2.getHalfExtents().y, box2.getHalfExtents().z };
+
+	// Rotation of box2 relative to box1 and its absolute values
+	double rotation[3][3];
+	double absRotation[3][3];
+
+	for (int i = 0; i < 3; i++)
+	{
+		const nddlgen::math::Vector3& axis1 = box1.getAxis(i);
+
+		for (int j = 0; j < 3; j++)
+		{
+			const nddlgen::math::Vector3& axis2 = box2.getAxis(j);
+
+			rotation[i][j] = axis1.x * axis2.x + axis1.y * axis2.y + axis1.z * axis2.z;
+			absRotation[i][j] = std::fabs(rotation[i][j]);
+		}
+	}
+
+	// Translation between the centers in the coordinate frame of box1
+	double dx = box2.getCenter().x - box1.getCenter().x;
+	double dy = box2.getCenter().y - box1.getCenter().y;
+	double dz = box2.getCenter().z - box1.getCenter().z;
+	double translation[3];
+
+	for (int i = 0; i < 3; i++)
+	{
+		const nddlgen::math::Vector3& axis1 = box1.getAxis(i);
+
+		translation[i] = dx * axis1.x + dy * axis1.y + dz * axis1.z;
+	}
+
+	// Face normals of box1
+	for (int i = 0; i < 3; i++)
+	{
+		double radius1 = extents1[i];
+		double radius2 = extents2[0] * absRotation[i][0] + extents2[1] * absRotation[i][1]
+				+ extents2[2] * absRotation[i][2];
+
+		if (std::fabs(translation[i]) >= radius1 + radius2)
+		{
+			return false;
+		}
+	}
+
+	// Face normals of box2
+	for (int j = 0; j < 3; j++)
+	{
+		double radius1 = extents1[0] * absRotation[0][j] + extents1[1] * absRotation[1][j]
+				+ extents1[2] * absRotation[2][j];
+		double radius2 = extents2[j];
+		double distance = std::fabs(translation[0] * rotation[0][j] + translation[1] * rotation[1][j]
+				+ translation[2] * rotation[2][j]);
+
+		if (distance >= radius1 + radius2)
+		{
+			return false;
+		}
+	}
+
+	// Cross products of each pair of face normals, unless they are degenerate. In the
+	// coordinate frame of box1, the cross product of its axis i and axis j of box2 has the
+	// components rotation[i1][j] and rotation[i2][j]
+	for (int i = 0; i < 3; i++)
+	{
+		int i1 = (i + 1) % 3;
+		int i2 = (i + 2) % 3;
+
+		for (int j = 0; j < 3; j++)
+		{
+			int j1 = (j + 1) % 3;
+			int j2 = (j + 2) % 3;
+
+			double squaredLength = rotation[i1][j] * rotation[i1][j] + rotation[i2][j] * rotation[i2][j];
+			double radius1 = extents1[i1] * absRotation[i2][j] + extents1[i2] * absRotation[i1][j];
+			double radius2 = extents2[j1] * absRotation[i][j2] + extents2[j2] * absRotation[i][j1];
+			double distance = std::fabs(translation[i2] * rotation[i1][j] - translation[i1] * rotation[i2][j]);
+
+			if (squaredLength >= OrientedBoundingBoxTest::DEGENERATE_AXIS_THRESHOLD
+					&& distance >= radius1 + radius2)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool nddlgen::math::OrientedBoundingBoxTest::doesIntersect(nddlgen::math::CuboidPtr box1,
+		nddlgen::math::CuboidPtr box2)
+{
+	return OrientedBoundingBoxTest::doesIntersect(*box1, *box2);
+}
@@ -0,0 +1,88 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_MATH_ORIENTEDBOUNDINGBOXTEST_H_
+#define NDDLGEN_MATH_ORIENTEDBOUNDINGBOXTEST_H_
+
+#include <cmath>
+
+#include <nddlgen/math/Cuboid.h>
+#include <nddlgen/math/Vector3.hpp>
+
+namespace nddlgen
+{
+	namespace math
+	{
+		class OrientedBoundingBoxTest;
+	}
+}
+
+/**
+ * Implementation of the separating axis theorem for oriented bounding boxes as described by
+ * Gottschalk, Lin and Manocha ("OBBTree", 1996). Works on the closed form of the cuboids
+ * (center, half extents and axes), so every one of the 15 axes is tested with a few products
+ * and absolute values instead of projecting all 16 vertices.
+ *
+ * Like nddlgen::math::SeparatingAxisTheoremTest, cuboids which only touch do not intersect,
+ * no matter whether they touch with faces or edges. For rotated cuboids in exact contact, both
+ * tests are subject to rounding errors, so their verdicts may still differ. If two axes are (nearly) parallel, their
+ * cross product degenerates to a null vector, which can not separate anything. Such cross
+ * product axes are skipped, as the face normals already decide the test in this case.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::math::OrientedBoundingBoxTest
+{
+
+	private:
+
+		/**
+		 * Private constructor to prevent instantiation.
+		 */
+		OrientedBoundingBoxTest();
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~OrientedBoundingBoxTest();
+
+	public:
+
+		/**
+		 * Cross product axes whose squared length is below this threshold are degenerate and
+		 * skipped. Since the face normals are unit vectors, this is the squared sine of the
+		 * angle between them.
+		 */
+		static const double DEGENERATE_AXIS_THRESHOLD;
+
+		/**
+		 * Checks if two objects (box1 and box2) do intersect.
+		 *
+		 * @param box1 First box
+		 * @param box2 Second box
+		 *
+		 * @return True, if boxes intersect, false if not
+		 */
+		static bool doesIntersect(const nddlgen::math::Cuboid& box1, const nddlgen::math::Cuboid& box2);
+
+		/**
+		 * @see doesIntersect(const nddlgen::math::Cuboid&, const nddlgen::math::Cuboid&)
+		 */
+		static bool doesIntersect(nddlgen::math::CuboidPtr box1, nddlgen::math::CuboidPtr box2);
+
+};
+
+#endif
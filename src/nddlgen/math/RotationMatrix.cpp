@@ -0,0 +1,124 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/math/RotationMatrix.h>
+
+nddlgen::math::RotationMatrix::RotationMatrix()
+{
+	for (int row = 0; row < 3; row++)
+	{
+		for (int column = 0; column < 3; column++)
+		{
+			this->_elements[row][column] = (row == column) ? 1 : 0;
+		}
+	}
+}
+
+nddlgen::math::RotationMatrix::~RotationMatrix()
+{
+
+}
+
+nddlgen::math::RotationMatrix nddlgen::math::RotationMatrix::fromRollPitchYaw(double roll, double pitch,
+		double yaw)
+{
+	// Invert angles since roll/pitch/yaw are considered to be counter-clockwise, while angles are
+	// clockwise (see CuboidOperations)
+	double sinRoll = std::sin(- roll);
+	double cosRoll = std::cos(- roll);
+	double sinPitch = std::sin(- pitch);
+	double cosPitch = std::cos(- pitch);
+	double sinYaw = std::sin(- yaw);
+	double cosYaw = std::cos(- yaw);
+
+	// Product of the yaw, pitch and roll matrices (in this order)
+	nddlgen::math::RotationMatrix rotation;
+
+	rotation._elements[0][0] = cosYaw * cosPitch;
+	rotation._elements[0][1] = - sinYaw * cosRoll - cosYaw * sinPitch * sinRoll;
+	rotation._elements[0][2] = sinYaw * sinRoll - cosYaw * sinPitch * cosRoll;
+
+	rotation._elements[1][0] = sinYaw * cosPitch;
+	rotation._elements[1][1] = cosYaw * cosRoll - sinYaw * sinPitch * sinRoll;
+	rotation._elements[1][2] = - cosYaw * sinRoll - sinYaw * sinPitch * cosRoll;
+
+	rotation._elements[2][0] = sinPitch;
+	rotation._elements[2][1] = cosPitch * sinRoll;
+	rotation._elements[2][2] = cosPitch * cosRoll;
+
+	return rotation;
+}
+
+nddlgen::math::RotationMatrix nddlgen::math::RotationMatrix::compose(double rollBase, double pitchBase,
+		double yawBase, double roll, double pitch, double yaw)
+{
+	// Rotations about the same axis add up, so rolling by both roll angles, pitching by both
+	// pitch angles and yawing by both yaw angles is one rotation per axis
+	return RotationMatrix::fromRollPitchYaw(rollBase + roll, pitchBase + pitch, yawBase + yaw);
+}
+
+nddlgen::math::RotationMatrix nddlgen::math::RotationMatrix::multiply(
+		const nddlgen::math::RotationMatrix& other) const
+{
+	nddlgen::math::RotationMatrix product;
+
+	for (int row = 0; row < 3; row++)
+	{
+		for (int column = 0; column < 3; column++)
+		{
+			product._elements[row][column] = this->_elements[row][0] * other._elements[0][column]
+					+ this->_elements[row][1] * other._elements[1][column]
+					+ this->_elements[row][2] * other._elements[2][column];
+		}
+	}
+
+	return product;
+}
+
+nddlgen::math::Vector3 nddlgen::math::RotationMatrix::apply(const nddlgen::math::Vector3& vector) const
+{
+	nddlgen::math::Vector3 rotated = {
+			this->_elements[0][0] * vector.x + this->_elements[0][1] * vector.y + this->_elements[0][2] * vector.z,
+			this->_elements[1][0] * vector.x + this->_elements[1][1] * vector.y + this->_elements[1][2] * vector.z,
+			this->_elements[2][0] * vector.x + this->_elements[2][1] * vector.y + this->_elements[2][2] * vector.z
+	};
+
+	return rotated;
+}
+
+void nddlgen::math::RotationMatrix::apply(nddlgen::math::Vector3* vectors, int count) const
+{
+	for (int i = 0; i < count; i++)
+	{
+		vectors[i] = this->apply(vectors[i]);
+	}
+}
+
+nddlgen::math::Vector3 nddlgen::math::RotationMatrix::getColumn(int column) const
+{
+	nddlgen::math::Vector3 vector = {
+			this->_elements[0][column],
+			this->_elements[1][column],
+			this->_elements[2][column]
+	};
+
+	return vector;
+}
+
+double nddlgen::math::RotationMatrix::getElement(int row, int column) const
+{
+	return this->_elements[row][column];
+}
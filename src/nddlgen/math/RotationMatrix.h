@@ -0,0 +1,141 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_MATH_ROTATIONMATRIX_H_
+#define NDDLGEN_MATH_ROTATIONMATRIX_H_
+
+#include <cmath>
+
+#include <nddlgen/math/Vector3.hpp>
+
+namespace nddlgen
+{
+	namespace math
+	{
+		class RotationMatrix;
+	}
+}
+
+/**
+ * 3x3 rotation matrix with value semantics. Used to compose the rotations of a pose once and
+ * apply them to any amount of vectors in a single pass, instead of rotating the vectors about
+ * every axis one after another.
+ *
+ * Follows the conventions of nddlgen::math::CuboidOperations: vectors are rolled first, then
+ * pitched, then yawed, and angles are interpreted the same way.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::math::RotationMatrix
+{
+
+	private:
+
+		/**
+		 * Elements, indexed by row and column.
+		 */
+		double _elements[3][3];
+
+	public:
+
+		/**
+		 * Constructs a new identity matrix.
+		 */
+		RotationMatrix();
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~RotationMatrix();
+
+		/**
+		 * Builds the rotation matrix of a roll, pitch and yaw angle. Applying it equals calling
+		 * CuboidOperations::roll(), CuboidOperations::pitch() and CuboidOperations::yaw() in
+		 * this order.
+		 *
+		 * @param roll Roll angle in radians
+		 * @param pitch Pitch angle in radians
+		 * @param yaw Yaw angle in radians
+		 *
+		 * @return Rotation matrix
+		 */
+		static nddlgen::math::RotationMatrix fromRollPitchYaw(double roll, double pitch, double yaw);
+
+		/**
+		 * Builds the rotation matrix of a pose relative to a base pose as it is defined in SDF:
+		 * the base and the relative angles are rolled first, then pitched, then yawed.
+		 *
+		 * @param rollBase Roll angle of the base pose in radians
+		 * @param pitchBase Pitch angle of the base pose in radians
+		 * @param yawBase Yaw angle of the base pose in radians
+		 * @param roll Roll angle of the pose in radians
+		 * @param pitch Pitch angle of the pose in radians
+		 * @param yaw Yaw angle of the pose in radians
+		 *
+		 * @return Rotation matrix
+		 */
+		static nddlgen::math::RotationMatrix compose(double rollBase, double pitchBase, double yawBase,
+				double roll, double pitch, double yaw);
+
+		/**
+		 * Multiplies this matrix with another one. Applying the product equals applying other
+		 * first and this matrix afterwards.
+		 *
+		 * @param other Right hand side
+		 *
+		 * @return Product
+		 */
+		nddlgen::math::RotationMatrix multiply(const nddlgen::math::RotationMatrix& other) const;
+
+		/**
+		 * Rotates a vector.
+		 *
+		 * @param vector Vector to be rotated
+		 *
+		 * @return Rotated vector
+		 */
+		nddlgen::math::Vector3 apply(const nddlgen::math::Vector3& vector) const;
+
+		/**
+		 * Rotates several vectors in place.
+		 *
+		 * @param vectors Vectors to be rotated
+		 * @param count Amount of vectors
+		 */
+		void apply(nddlgen::math::Vector3* vectors, int count) const;
+
+		/**
+		 * Gets a column of the matrix, which is the rotated unit vector of the according axis.
+		 *
+		 * @param column Column (0 = x, 1 = y, 2 = z)
+		 *
+		 * @return Column vector
+		 */
+		nddlgen::math::Vector3 getColumn(int column) const;
+
+		/**
+		 * Gets a single element.
+		 *
+		 * @param row Row
+		 * @param column Column
+		 *
+		 * @return Element
+		 */
+		double getElement(int row, int column) const;
+
+};
+
+#endif
@@ -26,65 +26,70 @@ nddlgen::math::SeparatingAxisTheoremTest::~SeparatingAxisTheoremTest()
 
 }
 
-bool nddlgen::math::SeparatingAxisTheoremTest::doesIntersect(nddlgen::math::CuboidPtr box1,
-		nddlgen::math::CuboidPtr box2)
+bool nddlgen::math::SeparatingAxisTheoremTest::doesIntersect(const nddlgen::math::Cuboid& box1,
+		const nddlgen::math::Cuboid& box2)
 {
 	// For all 15 projections, check if the projection does overlap. If it doesn't overlap once,
 	// the two cuboids do not intersect
-	if (!SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2, box1->getNormalXAxis())
-		|| !SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2, box1->getNormalYAxis())
-		|| !SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2, box1->getNormalZAxis())
-		|| !SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2, box2->getNormalXAxis())
-		|| !SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2, box2->getNormalYAxis())
-		|| !SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2, box2->getNormalZAxis())
-		|| !SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2,
-				VectorOperations::crossProduct(box1->getNormalXAxis(), box2->getNormalXAxis()))
-		|| !SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2,
-				VectorOperations::crossProduct(box1->getNormalXAxis(), box2->getNormalYAxis()))
-		|| !SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2,
-				VectorOperations::crossProduct(box1->getNormalXAxis(), box2->getNormalZAxis()))
-		|| !SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2,
-				VectorOperations::crossProduct(box1->getNormalYAxis(), box2->getNormalXAxis()))
-		|| !SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2,
-				VectorOperations::crossProduct(box1->getNormalYAxis(), box2->getNormalYAxis()))
-		|| !SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2,
-				VectorOperations::crossProduct(box1->getNormalYAxis(), box2->getNormalZAxis()))
-		|| !SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2,
-				VectorOperations::crossProduct(box1->getNormalZAxis(), box2->getNormalXAxis()))
-		|| !SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2,
-				VectorOperations::crossProduct(box1->getNormalZAxis(), box2->getNormalYAxis()))
-		|| !SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2,
-				VectorOperations::crossProduct(box1->getNormalZAxis(), box2->getNormalZAxis())))
+
+	// Face normals of box1
+	for (int i = 0; i < 3; i++)
+	{
+		if (!SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2, box1.getNormalValue(i)))
+		{
+			return false;
+		}
+	}
+
+	// Face normals of box2
+	for (int i = 0; i < 3; i++)
 	{
-		return false;
+		if (!SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2, box2.getNormalValue(i)))
+		{
+			return false;
+		}
+	}
+
+	// Cross products of each pair of face normals
+	for (int i = 0; i < 3; i++)
+	{
+		for (int j = 0; j < 3; j++)
+		{
+			if (!SeparatingAxisTheoremTest::doesProjectionIntersect(box1, box2,
+					VectorOperations::crossProduct(box1.getNormalValue(i), box2.getNormalValue(j))))
+			{
+				return false;
+			}
+		}
 	}
 
 	return true;
 }
 
-bool nddlgen::math::SeparatingAxisTheoremTest::doesProjectionIntersect(nddlgen::math::CuboidPtr box1,
-		nddlgen::math::CuboidPtr box2,
-		nddlgen::math::VectorPtr axis)
+bool nddlgen::math::SeparatingAxisTheoremTest::doesProjectionIntersect(const nddlgen::math::Cuboid& box1,
+		const nddlgen::math::Cuboid& box2,
+		const nddlgen::math::Vector3& axis)
 {
 	// Implementation adapted from Acegikmo (stackoverflow community member) from a C#/Unity example
 
-	if (axis->isNull())
+	if (VectorOperations::isNull(axis))
 	{
 		return true;
 	}
 
+	// Note that std::numeric_limits<double>::min() is the smallest positive value, not the lowest one
 	double aMin = std::numeric_limits<double>::max();
-	double aMax = std::numeric_limits<double>::min();
+	double aMax = - std::numeric_limits<double>::max();
 	double bMin = std::numeric_limits<double>::max();
-	double bMax = std::numeric_limits<double>::min();
+	double bMax = - std::numeric_limits<double>::max();
 
 	for (int i = 0; i < 8; i++)
 	{
-		double aDist = VectorOperations::dotProduct(box1->getVertex(i), axis);
+		double aDist = VectorOperations::dotProduct(box1.getVertexValue(i), axis);
 		aMin = Trivial::min(aDist, aMin);
 		aMax = Trivial::max(aDist, aMax);
 
-		double bDist = VectorOperations::dotProduct(box2->getVertex(i), axis);
+		double bDist = VectorOperations::dotProduct(box2.getVertexValue(i), axis);
 		bMin = Trivial::min(bDist, bMin);
 		bMax = Trivial::max(bDist, bMax);
 	}
@@ -94,3 +99,16 @@ bool nddlgen::math::SeparatingAxisTheoremTest::doesProjectionIntersect(nddlgen::
 
 	return longSpan < sumSpan;
 }
+
+bool nddlgen::math::SeparatingAxisTheoremTest::doesIntersect(nddlgen::math::CuboidPtr box1,
+		nddlgen::math::CuboidPtr box2)
+{
+	return SeparatingAxisTheoremTest::doesIntersect(*box1, *box2);
+}
+
+bool nddlgen::math::SeparatingAxisTheoremTest::doesProjectionIntersect(nddlgen::math::CuboidPtr box1,
+		nddlgen::math::CuboidPtr box2,
+		nddlgen::math::VectorPtr axis)
+{
+	return SeparatingAxisTheoremTest::doesProjectionIntersect(*box1, *box2, axis->getValue());
+}
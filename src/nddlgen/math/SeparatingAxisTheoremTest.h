@@ -20,6 +20,7 @@
 #include <limits>
 
 #include <nddlgen/math/Vector.h>
+#include <nddlgen/math/Vector3.hpp>
 #include <nddlgen/math/Cuboid.h>
 #include <nddlgen/math/Trivial.h>
 #include <nddlgen/math/VectorOperations.h>
@@ -63,7 +64,7 @@ class nddlgen::math::SeparatingAxisTheoremTest
 		 *
 		 * @return True, if boxes intersect according to SAT, false if not
 		 */
-		static bool doesIntersect(nddlgen::math::CuboidPtr box1, nddlgen::math::CuboidPtr box2);
+		static bool doesIntersect(const nddlgen::math::Cuboid& box1, const nddlgen::math::Cuboid& box2);
 
 		/**
 		 * Checks if the projection of two objects (box1 and box2) do intersect, when projected
@@ -77,6 +78,18 @@ class nddlgen::math::SeparatingAxisTheoremTest
 		 *
 		 * @return True, if the projections of the objects do intersect when projected to axis, false if not.
 		 */
+		static bool doesProjectionIntersect(const nddlgen::math::Cuboid& box1,
+				const nddlgen::math::Cuboid& box2,
+				const nddlgen::math::Vector3& axis);
+
+		/**
+		 * @see doesIntersect(const nddlgen::math::Cuboid&, const nddlgen::math::Cuboid&)
+		 */
+		static bool doesIntersect(nddlgen::math::CuboidPtr box1, nddlgen::math::CuboidPtr box2);
+
+		/**
+		 * @see doesProjectionIntersect(const nddlgen::math::Cuboid&, const nddlgen::math::Cuboid&, const nddlgen::math::Vector3&)
+		 */
 		static bool doesProjectionIntersect(nddlgen::math::CuboidPtr box1,
 				nddlgen::math::CuboidPtr box2,
 				nddlgen::math::VectorPtr axis);
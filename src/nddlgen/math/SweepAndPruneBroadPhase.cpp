@@ -0,0 +1,162 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/math/SweepAndPruneBroadPhase.h>
+
+nddlgen::math::SweepAndPruneBroadPhase::SweepAndPruneBroadPhase()
+{
+
+}
+
+nddlgen::math::SweepAndPruneBroadPhase::~SweepAndPruneBroadPhase()
+{
+
+}
+
+nddlgen::math::CandidateList nddlgen::math::SweepAndPruneBroadPhase::findCandidates(
+		const std::vector<nddlgen::math::AxisAlignedBoundingBox>& queryBoxes,
+		const std::vector<nddlgen::math::AxisAlignedBoundingBox>& targetBoxes)
+{
+	nddlgen::math::CandidateList candidates(queryBoxes.size());
+
+	int axis = SweepAndPruneBroadPhase::findSweepAxis(queryBoxes, targetBoxes);
+
+	// Collect intervals of all non-empty boxes on the sweep axis, sorted by their start
+	std::vector<Interval> intervals;
+	intervals.reserve(queryBoxes.size() + targetBoxes.size());
+
+	for (int i = 0; i < (int) queryBoxes.size(); i++)
+	{
+		if (!SweepAndPruneBroadPhase::isEmpty(queryBoxes[i]))
+		{
+			Interval interval = { queryBoxes[i].getMin(axis), queryBoxes[i].getMax(axis), i, true };
+			intervals.push_back(interval);
+		}
+	}
+
+	for (int i = 0; i < (int) targetBoxes.size(); i++)
+	{
+		if (!SweepAndPruneBroadPhase::isEmpty(targetBoxes[i]))
+		{
+			Interval interval = { targetBoxes[i].getMin(axis), targetBoxes[i].getMax(axis), i, false };
+			intervals.push_back(interval);
+		}
+	}
+
+	std::sort(intervals.begin(), intervals.end());
+
+	// Sweep over all intervals. Each interval is compared with the still active intervals of
+	// the other kind, i.e. those that did not end before it starts. Every overlapping pair is
+	// found exactly once, when the interval starting later is visited
+	std::vector<Interval> activeQueries;
+	std::vector<Interval> activeTargets;
+
+	foreach (const Interval& interval, intervals)
+	{
+		std::vector<Interval>& others = interval.isQuery ? activeTargets : activeQueries;
+		int remaining = 0;
+
+		for (int i = 0; i < (int) others.size(); i++)
+		{
+			// Intervals ending before this one starts can not overlap any later one either
+			if (others[i].max < interval.min)
+			{
+				continue;
+			}
+
+			others[remaining++] = others[i];
+
+			int query = interval.isQuery ? interval.index : others[i].index;
+			int target = interval.isQuery ? others[i].index : interval.index;
+
+			if (queryBoxes[query].overlaps(targetBoxes[target]))
+			{
+				candidates[query].push_back(target);
+			}
+		}
+
+		others.resize(remaining);
+
+		(interval.isQuery ? activeQueries : activeTargets).push_back(interval);
+	}
+
+	// Sort the result, so that the narrow phase runs in the same order as it would without pruning
+	foreach (std::vector<int>& queryCandidates, candidates)
+	{
+		std::sort(queryCandidates.begin(), queryCandidates.end());
+	}
+
+	return candidates;
+}
+
+int nddlgen::math::SweepAndPruneBroadPhase::findSweepAxis(
+		const std::vector<nddlgen::math::AxisAlignedBoundingBox>& queryBoxes,
+		const std::vector<nddlgen::math::AxisAlignedBoundingBox>& targetBoxes)
+{
+	double sum[3] = { 0, 0, 0 };
+	double squaredSum[3] = { 0, 0, 0 };
+	int count = 0;
+
+	const std::vector<nddlgen::math::AxisAlignedBoundingBox>* boxLists[2] = { &queryBoxes, &targetBoxes };
+
+	for (int list = 0; list < 2; list++)
+	{
+		foreach (const nddlgen::math::AxisAlignedBoundingBox& box, *boxLists[list])
+		{
+			if (SweepAndPruneBroadPhase::isEmpty(box))
+			{
+				continue;
+			}
+
+			for (int axis = 0; axis < 3; axis++)
+			{
+				double center = box.getCenter(axis);
+
+				sum[axis] += center;
+				squaredSum[axis] += center * center;
+			}
+
+			count++;
+		}
+	}
+
+	// Variance is proportional to count * squaredSum - sum^2, which is compared directly
+	int sweepAxis = 0;
+	double maxVariance = -1;
+
+	for (int axis = 0; axis < 3; axis++)
+	{
+		double variance = count * squaredSum[axis] - sum[axis] * sum[axis];
+
+		if (variance > maxVariance)
+		{
+			sweepAxis = axis;
+			maxVariance = variance;
+		}
+	}
+
+	return sweepAxis;
+}
+
+bool nddlgen::math::SweepAndPruneBroadPhase::isEmpty(const nddlgen::math::AxisAlignedBoundingBox& box)
+{
+	return box.getMin(0) > box.getMax(0) || box.getMin(1) > box.getMax(1) || box.getMin(2) > box.getMax(2);
+}
+
+bool nddlgen::math::SweepAndPruneBroadPhase::Interval::operator<(const Interval& other) const
+{
+	return this->min < other.min;
+}
@@ -0,0 +1,100 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_MATH_SWEEPANDPRUNEBROADPHASE_H_
+#define NDDLGEN_MATH_SWEEPANDPRUNEBROADPHASE_H_
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <nddlgen/math/AbstractBroadPhase.h>
+#include <nddlgen/utilities/Foreach.hpp>
+
+namespace nddlgen
+{
+	namespace math
+	{
+		class SweepAndPruneBroadPhase;
+		typedef boost::shared_ptr<nddlgen::math::SweepAndPruneBroadPhase> SweepAndPruneBroadPhasePtr;
+	}
+}
+
+/**
+ * Broad phase sorting the intervals of all boxes along the axis on which their centers vary
+ * the most, and sweeping over them in ascending order. Only boxes whose intervals overlap on
+ * this axis are compared on all three axes. Needs no index structure besides the sorted
+ * intervals, and works best if boxes are spread along a single axis, e.g. rows of shelves.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::math::SweepAndPruneBroadPhase : public nddlgen::math::AbstractBroadPhase
+{
+
+	private:
+
+		/**
+		 * Interval of a query or target box on the sweep axis.
+		 */
+		struct Interval
+		{
+			double min;
+			double max;
+			int index;
+			bool isQuery;
+
+			bool operator<(const Interval& other) const;
+		};
+
+		/**
+		 * Finds the axis along which the centers of all non-empty boxes have the largest variance.
+		 *
+		 * @return Axis (0 = x, 1 = y, 2 = z).
+		 */
+		static int findSweepAxis(
+				const std::vector<nddlgen::math::AxisAlignedBoundingBox>& queryBoxes,
+				const std::vector<nddlgen::math::AxisAlignedBoundingBox>& targetBoxes
+		);
+
+		/**
+		 * Tests if a box is empty, i.e. it does not overlap with anything.
+		 */
+		static bool isEmpty(const nddlgen::math::AxisAlignedBoundingBox& box);
+
+	public:
+
+		/**
+		 * Constructs a new sweep and prune broad phase.
+		 */
+		SweepAndPruneBroadPhase();
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~SweepAndPruneBroadPhase();
+
+		/**
+		 * @see nddlgen::math::AbstractBroadPhase::findCandidates
+		 */
+		virtual nddlgen::math::CandidateList findCandidates(
+				const std::vector<nddlgen::math::AxisAlignedBoundingBox>& queryBoxes,
+				const std::vector<nddlgen::math::AxisAlignedBoundingBox>& targetBoxes
+		);
+
+};
+
+#endif
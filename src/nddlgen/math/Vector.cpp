@@ -18,9 +18,14 @@
 
 nddlgen::math::Vector::Vector(double x, double y, double z)
 {
-	this->_x = x;
-	this->_y = y;
-	this->_z = z;
+	this->_value.x = x;
+	this->_value.y = y;
+	this->_value.z = z;
+}
+
+nddlgen::math::Vector::Vector(const nddlgen::math::Vector3& value)
+{
+	this->_value = value;
 }
 
 nddlgen::math::Vector::~Vector()
@@ -28,52 +33,57 @@ nddlgen::math::Vector::~Vector()
 
 }
 
+nddlgen::math::Vector3 nddlgen::math::Vector::getValue()
+{
+	return this->_value;
+}
+
 double nddlgen::math::Vector::getX()
 {
-	return this->_x;
+	return this->_value.x;
 }
 
 double nddlgen::math::Vector::getY()
 {
-	return this->_y;
+	return this->_value.y;
 }
 
 double nddlgen::math::Vector::getZ()
 {
-	return this->_z;
+	return this->_value.z;
 }
 
 void nddlgen::math::Vector::setX(double x)
 {
-	this->_x = x;
+	this->_value.x = x;
 }
 
 void nddlgen::math::Vector::setY(double y)
 {
-	this->_y = y;
+	this->_value.y = y;
 }
 
 void nddlgen::math::Vector::setZ(double z)
 {
-	this->_z = z;
+	this->_value.z = z;
 }
 
 void nddlgen::math::Vector::addX(double x)
 {
-	this->_x += x;
+	this->_value.x += x;
 }
 
 void nddlgen::math::Vector::addY(double y)
 {
-	this->_y += y;
+	this->_value.y += y;
 }
 
 void nddlgen::math::Vector::addZ(double z)
 {
-	this->_z += z;
+	this->_value.z += z;
 }
 
 bool nddlgen::math::Vector::isNull()
 {
-	return (this->_x == 0 && this->_y == 0 && this->_z == 0);
+	return (this->_value.x == 0 && this->_value.y == 0 && this->_value.z == 0);
 }
@@ -19,6 +19,8 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <nddlgen/math/Vector3.hpp>
+
 namespace nddlgen
 {
 	namespace math
@@ -28,20 +30,27 @@ namespace nddlgen
 	}
 }
 
+/**
+ * Heap allocated, shared vector. Kept for compatibility, internally all math operations
+ * work on nddlgen::math::Vector3 values.
+ *
+ * @author Christian Dreher
+ */
 class nddlgen::math::Vector
 {
 
 	private:
 
-		double _x;
-		double _y;
-		double _z;
+		nddlgen::math::Vector3 _value;
 
 	public:
 
 		Vector(double x, double y, double z);
+		Vector(const nddlgen::math::Vector3& value);
 		virtual ~Vector();
 
+		nddlgen::math::Vector3 getValue();
+
 		double getX();
 		double getY();
 		double getZ();
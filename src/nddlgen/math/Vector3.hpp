@@ -0,0 +1,42 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_MATH_VECTOR3_HPP_
+#define NDDLGEN_MATH_VECTOR3_HPP_
+
+namespace nddlgen
+{
+	namespace math
+	{
+		struct Vector3;
+	}
+}
+
+/**
+ * Plain three dimensional vector with value semantics. Unlike nddlgen::math::Vector, it is
+ * neither heap allocated nor reference counted, so arrays of it are stored contiguously.
+ * This is the representation used by all math operations internally.
+ *
+ * @author Christian Dreher
+ */
+struct nddlgen::math::Vector3
+{
+	double x;
+	double y;
+	double z;
+};
+
+#endif
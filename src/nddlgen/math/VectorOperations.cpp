@@ -28,44 +28,26 @@ nddlgen::math::VectorOperations::~VectorOperations()
 
 nddlgen::math::VectorPtr nddlgen::math::VectorOperations::plus(nddlgen::math::VectorPtr summand1, nddlgen::math::VectorPtr summand2)
 {
-	double x = summand1->getX() + summand2->getX();
-	double y = summand1->getY() + summand2->getY();
-	double z = summand1->getZ() + summand2->getZ();
-
-	nddlgen::math::VectorPtr sum(new Vector(x, y, z));
+	nddlgen::math::VectorPtr sum(new Vector(VectorOperations::plus(summand1->getValue(), summand2->getValue())));
 
 	return sum;
 }
 
 nddlgen::math::VectorPtr nddlgen::math::VectorOperations::minus(nddlgen::math::VectorPtr minuend, nddlgen::math::VectorPtr subtrahend)
 {
-	double x = minuend->getX() - subtrahend->getX();
-	double y = minuend->getY() - subtrahend->getY();
-	double z = minuend->getZ() - subtrahend->getZ();
-
-	nddlgen::math::VectorPtr difference(new Vector(x, y, z));
+	nddlgen::math::VectorPtr difference(new Vector(VectorOperations::minus(minuend->getValue(), subtrahend->getValue())));
 
 	return difference;
 }
 
 double nddlgen::math::VectorOperations::dotProduct(nddlgen::math::VectorPtr a, nddlgen::math::VectorPtr b)
 {
-	double dot = 0;
-
-	dot += a->getX() * b->getX();
-	dot += a->getY() * b->getY();
-	dot += a->getZ() * b->getZ();
-
-	return dot;
+	return VectorOperations::dotProduct(a->getValue(), b->getValue());
 }
 
 nddlgen::math::VectorPtr nddlgen::math::VectorOperations::crossProduct(nddlgen::math::VectorPtr a, nddlgen::math::VectorPtr b)
 {
-	double x = (a->getY() * b->getZ()) - (a->getZ() * b->getY());
-	double y = (a->getZ() * b->getX()) - (a->getX() * b->getZ());
-	double z = (a->getX() * b->getY()) - (a->getY() * b->getX());
-
-	nddlgen::math::VectorPtr cross(new Vector(x, y, z));
+	nddlgen::math::VectorPtr cross(new Vector(VectorOperations::crossProduct(a->getValue(), b->getValue())));
 
 	return cross;
 }
@@ -20,6 +20,7 @@
 #include <boost/shared_ptr.hpp>
 
 #include <nddlgen/math/Vector.h>
+#include <nddlgen/math/Vector3.hpp>
 
 namespace nddlgen
 {
@@ -29,6 +30,13 @@ namespace nddlgen
 	}
 }
 
+/**
+ * Operations on vectors. The overloads taking nddlgen::math::Vector3 values are defined inline,
+ * since they are used in the innermost loops of the collision detection. The overloads taking
+ * nddlgen::math::VectorPtr are kept for compatibility and delegate to them.
+ *
+ * @author Christian Dreher
+ */
 class nddlgen::math::VectorOperations
 {
 
@@ -39,6 +47,12 @@ class nddlgen::math::VectorOperations
 
 	public:
 
+		static nddlgen::math::Vector3 plus(const nddlgen::math::Vector3& summand1, const nddlgen::math::Vector3& summand2);
+		static nddlgen::math::Vector3 minus(const nddlgen::math::Vector3& minuend, const nddlgen::math::Vector3& subtrahend);
+		static double dotProduct(const nddlgen::math::Vector3& a, const nddlgen::math::Vector3& b);
+		static nddlgen::math::Vector3 crossProduct(const nddlgen::math::Vector3& a, const nddlgen::math::Vector3& b);
+		static bool isNull(const nddlgen::math::Vector3& a);
+
 		static nddlgen::math::VectorPtr plus(nddlgen::math::VectorPtr summand1, nddlgen::math::VectorPtr summand2);
 		static nddlgen::math::VectorPtr minus(nddlgen::math::VectorPtr minuend, nddlgen::math::VectorPtr subtrahend);
 		static double dotProduct(nddlgen::math::VectorPtr a, nddlgen::math::VectorPtr b);
@@ -46,4 +60,43 @@ class nddlgen::math::VectorOperations
 
 };
 
+inline nddlgen::math::Vector3 nddlgen::math::VectorOperations::plus(const nddlgen::math::Vector3& summand1,
+		const nddlgen::math::Vector3& summand2)
+{
+	nddlgen::math::Vector3 sum = { summand1.x + summand2.x, summand1.y + summand2.y, summand1.z + summand2.z };
+
+	return sum;
+}
+
+inline nddlgen::math::Vector3 nddlgen::math::VectorOperations::minus(const nddlgen::math::Vector3& minuend,
+		const nddlgen::math::Vector3& subtrahend)
+{
+	nddlgen::math::Vector3 difference = { minuend.x - subtrahend.x, minuend.y - subtrahend.y, minuend.z - subtrahend.z };
+
+	return difference;
+}
+
+inline double nddlgen::math::VectorOperations::dotProduct(const nddlgen::math::Vector3& a,
+		const nddlgen::math::Vector3& b)
+{
+	return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+inline nddlgen::math::Vector3 nddlgen::math::VectorOperations::crossProduct(const nddlgen::math::Vector3& a,
+		const nddlgen::math::Vector3& b)
+{
+	nddlgen::math::Vector3 cross = {
+			(a.y * b.z) - (a.z * b.y),
+			(a.z * b.x) - (a.x * b.z),
+			(a.x * b.y) - (a.y * b.x)
+	};
+
+	return cross;
+}
+
+inline bool nddlgen::math::VectorOperations::isNull(const nddlgen::math::Vector3& a)
+{
+	return (a.x == 0 && a.y == 0 && a.z == 0);
+}
+
 #endif
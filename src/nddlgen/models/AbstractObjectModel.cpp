@@ -41,12 +41,12 @@ void nddlgen::models::AbstractObjectModel::initActions()
 	// Dummy. Do nothing
 }
 
-void nddlgen::models::AbstractObjectModel::generateForwardDeclaration(std::ofstream& ofStream)
+void nddlgen::models::AbstractObjectModel::generateForwardDeclaration(nddlgen::utilities::OutputSink& outputSink)
 {
-	wrln(0, "class " + this->getClassName() + ";", 1);
+	outputSink.writeLine(0, "class " + this->getClassName() + ";", 1);
 }
 
-void nddlgen::models::AbstractObjectModel::generateInstantiation(std::ofstream& ofStream)
+void nddlgen::models::AbstractObjectModel::generateInstantiation(nddlgen::utilities::OutputSink& outputSink)
 {
 	std::string className = this->getClassName();
 	std::string instanceName = this->getName();
@@ -62,7 +62,7 @@ void nddlgen::models::AbstractObjectModel::generateInstantiation(std::ofstream&
 			std::string subObjectClassName = subObject->getClassName();
 			std::string subObjectInstanceName = subObject->getName();
 
-			subObject->generateInstantiation(ofStream);
+			subObject->generateInstantiation(outputSink);
 
 			constructorParameters += subObjectInstanceName + ", ";
 		}
@@ -70,10 +70,10 @@ void nddlgen::models::AbstractObjectModel::generateInstantiation(std::ofstream&
 		constructorParameters = constructorParameters.substr(0, constructorParameters.size() - 2);
 	}
 
-	wrln(0, className + " " + instanceName + " = new " + className + "(" + constructorParameters + ");", 1);
+	outputSink.writeLine(0, className + " " + instanceName + " = new " + className + "(" + constructorParameters + ");", 1);
 }
 
-void nddlgen::models::AbstractObjectModel::generateNddlClass(std::ofstream& ofStream)
+void nddlgen::models::AbstractObjectModel::generateNddlClass(nddlgen::utilities::OutputSink& outputSink)
 {
 	std::string extendsTimeline = "";
 
@@ -84,39 +84,39 @@ void nddlgen::models::AbstractObjectModel::generateNddlClass(std::ofstream& ofSt
 		extendsTimeline = " extends Timeline";
 	}
 
-	wrln(0, "class " + this->_className + extendsTimeline, 1);
-	wrln(0, "{", 1);
+	outputSink.writeLine(0, "class " + this->_className + extendsTimeline, 1);
+	outputSink.writeLine(0, "{", 1);
 
 	// Print predicates if present
-	this->generateNddlClassPredicates(ofStream);
+	this->generateNddlClassPredicates(outputSink);
 
 	// Print sub objects as member if present
-	this->generateNddlClassMembers(ofStream);
+	this->generateNddlClassMembers(outputSink);
 
 	// Print constructor if sub objects are set
-	this->generateNddlClassConstructor(ofStream);
+	this->generateNddlClassConstructor(outputSink);
 
-	wrln(0, "}", 2);
+	outputSink.writeLine(0, "}", 2);
 }
 
-void nddlgen::models::AbstractObjectModel::generateNddlClassPredicates(std::ofstream& ofStream)
+void nddlgen::models::AbstractObjectModel::generateNddlClassPredicates(nddlgen::utilities::OutputSink& outputSink)
 {
 	// Print predicates if present
 	if (this->hasPredicates())
 	{
 		foreach (std::string predicate, this->_predicates)
 		{
-			wrln(1, "predicate " + predicate + " {}", 1);
+			outputSink.writeLine(1, "predicate " + predicate + " {}", 1);
 		}
 
 		if (this->hasSubObjects())
 		{
-			wrel(1);
+			outputSink.writeEmptyLines(1);
 		}
 	}
 }
 
-void nddlgen::models::AbstractObjectModel::generateNddlClassMembers(std::ofstream& ofStream)
+void nddlgen::models::AbstractObjectModel::generateNddlClassMembers(nddlgen::utilities::OutputSink& outputSink)
 {
 	// Only print members if the model has any sub objects
 	if (this->hasSubObjects())
@@ -127,14 +127,14 @@ void nddlgen::models::AbstractObjectModel::generateNddlClassMembers(std::ofstrea
 			std::string className = generatableModel->getClassName();
 			std::string instanceName = generatableModel->getNamePref();
 
-			wrln(1, className + " " + instanceName + ";", 1);
+			outputSink.writeLine(1, className + " " + instanceName + ";", 1);
 		}
 
-		wrel(1);
+		outputSink.writeEmptyLines(1);
 	}
 }
 
-void nddlgen::models::AbstractObjectModel::generateNddlClassConstructor(std::ofstream& ofStream)
+void nddlgen::models::AbstractObjectModel::generateNddlClassConstructor(nddlgen::utilities::OutputSink& outputSink)
 {
 	// Only print constructor if the model has any sub objects
 	if (this->hasSubObjects())
@@ -152,17 +152,17 @@ void nddlgen::models::AbstractObjectModel::generateNddlClassConstructor(std::ofs
 
 		constructorHeader += ")";
 
-		wrln(1, constructorHeader, 1);
-		wrln(1, "{", 1);
+		outputSink.writeLine(1, constructorHeader, 1);
+		outputSink.writeLine(1, "{", 1);
 
 		foreach (nddlgen::models::AbstractObjectModelPtr generatableModel, this->_subObjects)
 		{
 			std::string assignment = generatableModel->getNamePref() + " = " + generatableModel->getNamePrefSuff() + ";";
 
-			wrln(2, assignment, 1);
+			outputSink.writeLine(2, assignment, 1);
 		}
 
-		wrln(1, "}", 1);
+		outputSink.writeLine(1, "}", 1);
 	}
 }
 
@@ -220,6 +220,11 @@ bool nddlgen::models::AbstractObjectModel::hasBlockingObjects()
 	return (this->_blockingObjects.size() != 0);
 }
 
+void nddlgen::models::AbstractObjectModel::clearBlockingObjects()
+{
+	this->_blockingObjects.clear();
+}
+
 void nddlgen::models::AbstractObjectModel::addPredicate(std::string predicate)
 {
 	this->_predicates.push_back(predicate);
@@ -30,7 +30,7 @@
 #include <nddlgen/models/ActionModel.h>
 #include <nddlgen/models/InitialStateFactModel.h>
 #include <nddlgen/utilities/Types.hpp>
-#include <nddlgen/utilities/WriteStream.hpp>
+#include <nddlgen/utilities/OutputSink.h>
 #include <nddlgen/utilities/Foreach.hpp>
 
 namespace nddlgen
@@ -68,15 +68,15 @@ class nddlgen::models::AbstractObjectModel : public boost::enable_shared_from_th
 		boost::weak_ptr<nddlgen::models::AbstractObjectModel> _superObject;
 
 		void generateNddlClassPredicates(
-				std::ofstream& ofStream
+				nddlgen::utilities::OutputSink& outputSink
 		);
 
 		void generateNddlClassMembers(
-				std::ofstream& ofStream
+				nddlgen::utilities::OutputSink& outputSink
 		);
 
 		void generateNddlClassConstructor(
-				std::ofstream& ofStream
+				nddlgen::utilities::OutputSink& outputSink
 		);
 
 	public:
@@ -92,15 +92,15 @@ class nddlgen::models::AbstractObjectModel : public boost::enable_shared_from_th
 		virtual void initActions();
 
 		virtual void generateForwardDeclaration(
-				std::ofstream& ofStream
+				nddlgen::utilities::OutputSink& outputSink
 		);
 
 		virtual void generateNddlClass(
-				std::ofstream& ofStream
+				nddlgen::utilities::OutputSink& outputSink
 		);
 
 		virtual void generateInstantiation(
-				std::ofstream& ofStream
+				nddlgen::utilities::OutputSink& outputSink
 		);
 
 		void setName(
@@ -127,6 +127,8 @@ class nddlgen::models::AbstractObjectModel : public boost::enable_shared_from_th
 
 		bool hasBlockingObjects();
 
+		void clearBlockingObjects();
+
 		void addPredicate(
 				std::string predicate
 		);
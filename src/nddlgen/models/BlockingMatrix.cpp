@@ -0,0 +1,266 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/models/BlockingMatrix.h>
+
+nddlgen::models::BlockingMatrix::BlockingMatrix()
+{
+	this->resize(0);
+}
+
+nddlgen::models::BlockingMatrix::BlockingMatrix(int objectCount)
+{
+	this->resize(objectCount);
+}
+
+nddlgen::models::BlockingMatrix::~BlockingMatrix()
+{
+
+}
+
+void nddlgen::models::BlockingMatrix::resize(int objectCount)
+{
+	this->_objectCount = objectCount;
+	this->_wordCount = (objectCount + 63) / 64;
+
+	this->_rows.assign(objectCount * this->_wordCount, 0);
+	this->_columns.assign(objectCount * this->_wordCount, 0);
+}
+
+int nddlgen::models::BlockingMatrix::getObjectCount() const
+{
+	return this->_objectCount;
+}
+
+void nddlgen::models::BlockingMatrix::set(int blocked, int blocking)
+{
+	this->_rows[blocked * this->_wordCount + blocking / 64] |= ((boost::uint64_t) 1) << (blocking % 64);
+	this->_columns[blocking * this->_wordCount + blocked / 64] |= ((boost::uint64_t) 1) << (blocked % 64);
+}
+
+void nddlgen::models::BlockingMatrix::reset(int blocked, int blocking)
+{
+	this->_rows[blocked * this->_wordCount + blocking / 64] &= ~(((boost::uint64_t) 1) << (blocking % 64));
+	this->_columns[blocking * this->_wordCount + blocked / 64] &= ~(((boost::uint64_t) 1) << (blocked % 64));
+}
+
+void nddlgen::models::BlockingMatrix::clearBlockingObjects(int blocked)
+{
+	// Remove the object from the columns of its blocking objects first
+	for (int blocking = this->findNextBlockingObject(blocked, 0); blocking != -1;
+			blocking = this->findNextBlockingObject(blocked, blocking + 1))
+	{
+		this->_columns[blocking * this->_wordCount + blocked / 64] &= ~(((boost::uint64_t) 1) << (blocked % 64));
+	}
+
+	std::fill(this->_rows.begin() + blocked * this->_wordCount,
+			this->_rows.begin() + (blocked + 1) * this->_wordCount, 0);
+}
+
+bool nddlgen::models::BlockingMatrix::isBlockedBy(int blocked, int blocking) const
+{
+	return (this->_rows[blocked * this->_wordCount + blocking / 64] >> (blocking % 64)) & 1;
+}
+
+int nddlgen::models::BlockingMatrix::findNextBlockingObject(int blocked, int from) const
+{
+	return this->findNext(&this->_rows[0] + blocked * this->_wordCount, from);
+}
+
+int nddlgen::models::BlockingMatrix::findNextBlockedObject(int blocking, int from) const
+{
+	return this->findNext(&this->_columns[0] + blocking * this->_wordCount, from);
+}
+
+std::vector<int> nddlgen::models::BlockingMatrix::getBlockingObjects(int blocked) const
+{
+	return this->collect(&this->_rows[0] + blocked * this->_wordCount);
+}
+
+std::vector<int> nddlgen::models::BlockingMatrix::getBlockedObjects(int blocking) const
+{
+	return this->collect(&this->_columns[0] + blocking * this->_wordCount);
+}
+
+int nddlgen::models::BlockingMatrix::countBlockingObjects(int blocked) const
+{
+	return this->count(&this->_rows[0] + blocked * this->_wordCount);
+}
+
+int nddlgen::models::BlockingMatrix::countBlockedObjects(int blocking) const
+{
+	return this->count(&this->_columns[0] + blocking * this->_wordCount);
+}
+
+int nddlgen::models::BlockingMatrix::countBlockingRelations() const
+{
+	int relations = 0;
+
+	foreach (boost::uint64_t word, this->_rows)
+	{
+		relations += BlockingMatrix::countBits(word);
+	}
+
+	return relations;
+}
+
+nddlgen::models::BlockingMatrixPtr nddlgen::models::BlockingMatrix::getTransitiveClosure() const
+{
+	nddlgen::models::BlockingMatrixPtr closure(new nddlgen::models::BlockingMatrix(*this));
+	int wordCount = this->_wordCount;
+
+	// Warshall's algorithm on whole words: Every object blocked by k is also blocked by
+	// everything blocking k. Columns are kept up to date, so the objects blocked by k can be
+	// iterated directly
+	for (int k = 0; k < this->_objectCount; k++)
+	{
+		boost::uint64_t* rowK = &closure->_rows[0] + k * wordCount;
+
+		for (int i = closure->findNextBlockedObject(k, 0); i != -1; i = closure->findNextBlockedObject(k, i + 1))
+		{
+			boost::uint64_t* rowI = &closure->_rows[0] + i * wordCount;
+
+			for (int w = 0; w < wordCount; w++)
+			{
+				boost::uint64_t added = rowK[w] & ~rowI[w];
+
+				// Mirror new bits into the columns
+				while (added)
+				{
+					int blocking = w * 64 + BlockingMatrix::findFirstBit(added);
+
+					closure->_columns[blocking * wordCount + i / 64] |= ((boost::uint64_t) 1) << (i % 64);
+					added &= added - 1;
+				}
+
+				rowI[w] |= rowK[w];
+			}
+		}
+	}
+
+	return closure;
+}
+
+std::vector<int> nddlgen::models::BlockingMatrix::getTransitivelyBlockingObjects(int blocked) const
+{
+	int wordCount = this->_wordCount;
+
+	// Objects reached so far, and objects whose blocking objects were already added
+	std::vector<boost::uint64_t> reached(this->_rows.begin() + blocked * wordCount,
+			this->_rows.begin() + (blocked + 1) * wordCount);
+	std::vector<boost::uint64_t> expanded(wordCount, 0);
+
+	bool hasChanged = true;
+
+	while (hasChanged)
+	{
+		hasChanged = false;
+
+		for (int w = 0; w < wordCount; w++)
+		{
+			boost::uint64_t pending = reached[w] & ~expanded[w];
+
+			while (pending)
+			{
+				int blocking = w * 64 + BlockingMatrix::findFirstBit(pending);
+				const boost::uint64_t* row = &this->_rows[0] + blocking * wordCount;
+
+				expanded[w] |= pending & (~pending + 1);
+				pending &= pending - 1;
+
+				for (int v = 0; v < wordCount; v++)
+				{
+					hasChanged = hasChanged || (row[v] & ~reached[v]);
+					reached[v] |= row[v];
+				}
+			}
+		}
+	}
+
+	return this->collect(&reached[0]);
+}
+
+int nddlgen::models::BlockingMatrix::findNext(const boost::uint64_t* words, int from) const
+{
+	if (from >= this->_objectCount)
+	{
+		return -1;
+	}
+
+	int w = from / 64;
+	boost::uint64_t word = words[w] & (~((boost::uint64_t) 0) << (from % 64));
+
+	while (!word)
+	{
+		if (++w == this->_wordCount)
+		{
+			return -1;
+		}
+
+		word = words[w];
+	}
+
+	return w * 64 + BlockingMatrix::findFirstBit(word);
+}
+
+std::vector<int> nddlgen::models::BlockingMatrix::collect(const boost::uint64_t* words) const
+{
+	std::vector<int> ids;
+
+	for (int w = 0; w < this->_wordCount; w++)
+	{
+		for (boost::uint64_t word = words[w]; word; word &= word - 1)
+		{
+			ids.push_back(w * 64 + BlockingMatrix::findFirstBit(word));
+		}
+	}
+
+	return ids;
+}
+
+int nddlgen::models::BlockingMatrix::count(const boost::uint64_t* words) const
+{
+	int bits = 0;
+
+	for (int w = 0; w < this->_wordCount; w++)
+	{
+		bits += BlockingMatrix::countBits(words[w]);
+	}
+
+	return bits;
+}
+
+int nddlgen::models::BlockingMatrix::countBits(boost::uint64_t word)
+{
+#if defined(__GNUC__)
+	return __builtin_popcountll(word);
+#else
+	word = word - ((word >> 1) & 0x5555555555555555ULL);
+	word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+	word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+	return (int) ((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+int nddlgen::models::BlockingMatrix::findFirstBit(boost::uint64_t word)
+{
+#if defined(__GNUC__)
+	return __builtin_ctzll(word);
+#else
+	return BlockingMatrix::countBits((word & (~word + 1)) - 1);
+#endif
+}
@@ -0,0 +1,244 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_MODELS_BLOCKINGMATRIX_H_
+#define NDDLGEN_MODELS_BLOCKINGMATRIX_H_
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <nddlgen/utilities/Foreach.hpp>
+
+namespace nddlgen
+{
+	namespace models
+	{
+		class BlockingMatrix;
+		typedef boost::shared_ptr<nddlgen::models::BlockingMatrix> BlockingMatrixPtr;
+	}
+}
+
+/**
+ * Dense bit matrix of the blocking relations between objects. Objects are addressed by an id,
+ * which is their index within the objects of the workspace. Row i holds the objects blocking
+ * object i, column j holds the objects blocked by object j.
+ *
+ * The matrix is stored twice, row major and column major, so rows as well as columns can be
+ * iterated word by word.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::models::BlockingMatrix
+{
+
+	private:
+
+		/**
+		 * Amount of objects, i.e. amount of rows and columns.
+		 */
+		int _objectCount;
+
+		/**
+		 * Amount of 64 bit words per row or column.
+		 */
+		int _wordCount;
+
+		/**
+		 * Row major bits. Bit j of row i is set, if object i is blocked by object j.
+		 */
+		std::vector<boost::uint64_t> _rows;
+
+		/**
+		 * Column major bits. Bit i of column j is set, if object i is blocked by object j.
+		 */
+		std::vector<boost::uint64_t> _columns;
+
+		/**
+		 * Finds the next set bit in a row or column.
+		 *
+		 * @param words First word of the row or column
+		 * @param from Index to start searching at
+		 *
+		 * @return Index of the next set bit, or -1 if there is none.
+		 */
+		int findNext(const boost::uint64_t* words, int from) const;
+
+		/**
+		 * Collects all set bits of a row or column.
+		 */
+		std::vector<int> collect(const boost::uint64_t* words) const;
+
+		/**
+		 * Counts the set bits of a row or column.
+		 */
+		int count(const boost::uint64_t* words) const;
+
+		/**
+		 * Counts the set bits of a word.
+		 */
+		static int countBits(boost::uint64_t word);
+
+		/**
+		 * Gets the index of the lowest set bit of a non-zero word.
+		 */
+		static int findFirstBit(boost::uint64_t word);
+
+	public:
+
+		/**
+		 * Constructs a new, empty blocking matrix.
+		 */
+		BlockingMatrix();
+
+		/**
+		 * Constructs a new blocking matrix without any blocking relations.
+		 *
+		 * @param objectCount Amount of objects
+		 */
+		BlockingMatrix(int objectCount);
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~BlockingMatrix();
+
+		/**
+		 * Resizes the matrix and removes all blocking relations.
+		 *
+		 * @param objectCount Amount of objects
+		 */
+		void resize(int objectCount);
+
+		/**
+		 * Gets the amount of objects.
+		 *
+		 * @return Amount of objects.
+		 */
+		int getObjectCount() const;
+
+		/**
+		 * Sets object blocked to be blocked by object blocking.
+		 */
+		void set(int blocked, int blocking);
+
+		/**
+		 * Removes the blocking relation between object blocked and object blocking.
+		 */
+		void reset(int blocked, int blocking);
+
+		/**
+		 * Removes all objects blocking an object.
+		 *
+		 * @param blocked Id of the object
+		 */
+		void clearBlockingObjects(int blocked);
+
+		/**
+		 * Tests if an object is blocked by another object.
+		 *
+		 * @return True, if object blocked is blocked by object blocking, false if not.
+		 */
+		bool isBlockedBy(int blocked, int blocking) const;
+
+		/**
+		 * Finds the next object blocking an object. To iterate all blocking objects, start with
+		 * 0 and continue with the last result + 1 until -1 is returned.
+		 *
+		 * @param blocked Id of the object
+		 * @param from Id to start searching at
+		 *
+		 * @return Id of the next blocking object, or -1 if there is none.
+		 */
+		int findNextBlockingObject(int blocked, int from) const;
+
+		/**
+		 * Finds the next object blocked by an object. To iterate all blocked objects, start with
+		 * 0 and continue with the last result + 1 until -1 is returned.
+		 *
+		 * @param blocking Id of the object
+		 * @param from Id to start searching at
+		 *
+		 * @return Id of the next blocked object, or -1 if there is none.
+		 */
+		int findNextBlockedObject(int blocking, int from) const;
+
+		/**
+		 * Gets all objects blocking an object.
+		 *
+		 * @param blocked Id of the object
+		 *
+		 * @return Ids of all blocking objects, in ascending order.
+		 */
+		std::vector<int> getBlockingObjects(int blocked) const;
+
+		/**
+		 * Gets all objects blocked by an object.
+		 *
+		 * @param blocking Id of the object
+		 *
+		 * @return Ids of all blocked objects, in ascending order.
+		 */
+		std::vector<int> getBlockedObjects(int blocking) const;
+
+		/**
+		 * Counts the objects blocking an object.
+		 *
+		 * @param blocked Id of the object
+		 *
+		 * @return Amount of blocking objects.
+		 */
+		int countBlockingObjects(int blocked) const;
+
+		/**
+		 * Counts the objects blocked by an object.
+		 *
+		 * @param blocking Id of the object
+		 *
+		 * @return Amount of blocked objects.
+		 */
+		int countBlockedObjects(int blocking) const;
+
+		/**
+		 * Counts all blocking relations.
+		 *
+		 * @return Amount of blocking relations.
+		 */
+		int countBlockingRelations() const;
+
+		/**
+		 * Computes the transitive closure, in which an object is blocked by every object that
+		 * blocks it directly or blocks one of its blocking objects.
+		 *
+		 * @return New matrix containing the transitive closure.
+		 */
+		nddlgen::models::BlockingMatrixPtr getTransitiveClosure() const;
+
+		/**
+		 * Gets all objects blocking an object directly or transitively, without computing the
+		 * whole transitive closure.
+		 *
+		 * @param blocked Id of the object
+		 *
+		 * @return Ids of all directly or transitively blocking objects, in ascending order.
+		 */
+		std::vector<int> getTransitivelyBlockingObjects(int blocked) const;
+
+};
+
+#endif
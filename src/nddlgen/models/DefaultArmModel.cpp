@@ -34,31 +34,31 @@ void nddlgen::models::DefaultArmModel::initSubObjects()
 	this->addSubObject(armProcess);
 }
 
-void nddlgen::models::DefaultArmModel::generateNddlClass(std::ofstream& ofStream)
+void nddlgen::models::DefaultArmModel::generateNddlClass(nddlgen::utilities::OutputSink& outputSink)
 {
 	// Arm needs Timeline, since actions should be executed one by one
-	wrln(0, "class " + this->_className + " extends Timeline", 1);
-	wrln(0, "{", 1);
+	outputSink.writeLine(0, "class " + this->_className + " extends Timeline", 1);
+	outputSink.writeLine(0, "{", 1);
 
 	// Print predicates if present
-	this->generateNddlClassPredicates(ofStream);
+	this->generateNddlClassPredicates(outputSink);
 
 	// Print sub objects as member if present
-	this->generateNddlClassMembers(ofStream);
+	this->generateNddlClassMembers(outputSink);
 
 	// Print constructor if sub objects are set
-	this->generateNddlClassConstructor(ofStream);
+	this->generateNddlClassConstructor(outputSink);
 
 	// Additional line to devide constructor and actions
-	wrel(1);
+	outputSink.writeEmptyLines(1);
 
 	// Print action prototypes
 	foreach (std::string actionPrototype, this->_actionPrototypes)
 	{
-		wrln(1, actionPrototype, 1);
+		outputSink.writeLine(1, actionPrototype, 1);
 	}
 
-	wrln(0, "}", 2);
+	outputSink.writeLine(0, "}", 2);
 }
 
 nddlgen::models::DefaultWorkspaceModelPtr nddlgen::models::DefaultArmModel::getWorkspace()
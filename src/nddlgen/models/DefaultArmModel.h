@@ -51,7 +51,7 @@ class nddlgen::models::DefaultArmModel : public nddlgen::models::AbstractObjectM
 
 		virtual void initSubObjects();
 
-		virtual void generateNddlClass(std::ofstream& ofStream);
+		virtual void generateNddlClass(nddlgen::utilities::OutputSink& outputSink);
 
 		nddlgen::models::DefaultWorkspaceModelPtr getWorkspace();
 
@@ -40,8 +40,8 @@ class nddlgen::models::DefaultWorkspaceModel : public nddlgen::models::AbstractO
 
 	private:
 
-		void generateWorkspaceMembers(std::ofstream& ofStream);
-		void generateWorkspaceConstructor(std::ofstream& ofStream);
+		void generateWorkspaceMembers(nddlgen::utilities::OutputSink& outputSink);
+		void generateWorkspaceConstructor(nddlgen::utilities::OutputSink& outputSink);
 
 	public:
 
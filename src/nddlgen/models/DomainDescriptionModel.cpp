@@ -18,7 +18,7 @@
 
 nddlgen::models::DomainDescriptionModel::DomainDescriptionModel()
 {
-
+	this->_blockingMatrix.reset(new nddlgen::models::BlockingMatrix());
 }
 
 nddlgen::models::DomainDescriptionModel::~DomainDescriptionModel()
@@ -56,64 +56,122 @@ nddlgen::types::ActionList nddlgen::models::DomainDescriptionModel::getActions()
 	return this->_actions;
 }
 
+nddlgen::models::BlockingMatrixPtr nddlgen::models::DomainDescriptionModel::getBlockingMatrix()
+{
+	return this->_blockingMatrix;
+}
+
 void nddlgen::models::DomainDescriptionModel::addUsedNddlClass(nddlgen::models::AbstractObjectModelPtr object)
 {
 	this->_usedNddlClasses.insert(std::pair<std::string, nddlgen::models::AbstractObjectModelPtr>(object->getClassName(),
 			object));
 }
 
-void nddlgen::models::DomainDescriptionModel::generateForwardDeclarations(std::ofstream& ofStream)
+void nddlgen::models::DomainDescriptionModel::generateForwardDeclarations(nddlgen::utilities::OutputSink& outputSink)
 {
 	for (std::map<std::string, nddlgen::models::AbstractObjectModelPtr>::iterator it = this->_usedNddlClasses.begin();
 			it != this->_usedNddlClasses.end(); it++)
 	{
-		it->second->generateForwardDeclaration(ofStream);
+		it->second->generateForwardDeclaration(outputSink);
 	}
 
-	wrel(1);
+	outputSink.writeEmptyLines(1);
 }
 
-void nddlgen::models::DomainDescriptionModel::generateInstantiations(std::ofstream& ofStream)
+void nddlgen::models::DomainDescriptionModel::generateInstantiations(nddlgen::utilities::OutputSink& outputSink)
 {
-	this->_arm->generateInstantiation(ofStream);
+	this->_arm->generateInstantiation(outputSink);
 
-	wrel(1);
+	outputSink.writeEmptyLines(1);
 }
 
-void nddlgen::models::DomainDescriptionModel::generateNddlClasses(std::ofstream& ofStream)
+void nddlgen::models::DomainDescriptionModel::generateNddlClasses(nddlgen::utilities::OutputSink& outputSink)
 {
+	// Without thread pool, render each class directly into the output sink
+	if (!this->_threadPool)
+	{
+		for (std::map<std::string, nddlgen::models::AbstractObjectModelPtr>::iterator it = this->_usedNddlClasses.begin();
+				it != this->_usedNddlClasses.end(); it++)
+		{
+			it->second->generateNddlClass(outputSink);
+		}
+
+		return;
+	}
+
+	// Render all classes into buffers of their own, indexed like the map
+	std::vector<nddlgen::models::AbstractObjectModelPtr> classes;
+	classes.reserve(this->_usedNddlClasses.size());
+
 	for (std::map<std::string, nddlgen::models::AbstractObjectModelPtr>::iterator it = this->_usedNddlClasses.begin();
 			it != this->_usedNddlClasses.end(); it++)
 	{
-		it->second->generateNddlClass(ofStream);
+		classes.push_back(it->second);
+	}
+
+	std::vector<std::string> buffers(classes.size());
+
+	this->_threadPool->parallelFor((int) classes.size(), boost::bind(
+			&DomainDescriptionModel::nddlClassRenderingHelper, this, _1, boost::cref(classes),
+			boost::ref(buffers)));
+
+	// Write buffers in map order
+	foreach (const std::string& buffer, buffers)
+	{
+		outputSink.write(buffer);
 	}
 }
 
-void nddlgen::models::DomainDescriptionModel::generateActions(std::ofstream& ofStream)
+void nddlgen::models::DomainDescriptionModel::generateActions(nddlgen::utilities::OutputSink& outputSink)
 {
 	std::string armClass = this->getArm()->getClassName();
 
-	// Iterate through all actions and print it
-	foreach (nddlgen::models::ActionModelPtr action, this->_actions)
+	// Without thread pool, iterate through all actions and print it
+	if (!this->_threadPool)
 	{
-		std::string actionName = action->getName();
-		std::list<std::string> actionSteps = action->getActionSteps();
-
-		// Arm member function
-		wrln(0, armClass + "::" + actionName, 1);
-		wrln(0, "{", 1);
-
-		// Print each line
-		foreach (std::string actionStep, actionSteps)
+		foreach (nddlgen::models::ActionModelPtr action, this->_actions)
 		{
-			wrln(1, actionStep, 1);
+			this->generateAction(action, armClass, outputSink);
 		}
 
-		wrln(0, "}", 2);
+		return;
+	}
+
+	// Render all actions into buffers of their own, indexed like the list
+	std::vector<nddlgen::models::ActionModelPtr> actions(this->_actions.begin(), this->_actions.end());
+	std::vector<std::string> buffers(actions.size());
+
+	this->_threadPool->parallelFor((int) actions.size(), boost::bind(
+			&DomainDescriptionModel::actionRenderingHelper, this, _1, boost::cref(actions),
+			boost::cref(armClass), boost::ref(buffers)));
+
+	// Write buffers in list order
+	foreach (const std::string& buffer, buffers)
+	{
+		outputSink.write(buffer);
 	}
 }
 
-void nddlgen::models::DomainDescriptionModel::generateFacts(std::ofstream& ofStream)
+void nddlgen::models::DomainDescriptionModel::generateAction(nddlgen::models::ActionModelPtr action,
+		const std::string& armClass, nddlgen::utilities::OutputSink& outputSink)
+{
+	std::string actionName = action->getName();
+	std::list<std::string> actionSteps = action->getActionSteps();
+
+	// Arm member function
+	outputSink.writeLine(0, armClass + "::" + actionName, 1);
+	outputSink.writeLine(0, "{", 1);
+
+	// Print each line
+	foreach (std::string actionStep, actionSteps)
+	{
+		outputSink.writeLine(1, actionStep, 1);
+	}
+
+	outputSink.writeLine(0, "}", 2);
+}
+
+void nddlgen::models::DomainDescriptionModel::generateFacts(nddlgen::utilities::OutputSink& outputSink)
 {
 	// Get facts
 	nddlgen::types::FactList facts = this->getInitialState()->getFacts();
@@ -127,14 +185,14 @@ void nddlgen::models::DomainDescriptionModel::generateFacts(std::ofstream& ofStr
 		// Print each line
 		foreach (std::string factLine, factLines)
 		{
-			wrln(0, factLine, 1);
+			outputSink.writeLine(0, factLine, 1);
 		}
 
-		wrel(1);
+		outputSink.writeEmptyLines(1);
 	}
 }
 
-void nddlgen::models::DomainDescriptionModel::generateGoals(std::ofstream& ofStream)
+void nddlgen::models::DomainDescriptionModel::generateGoals(nddlgen::utilities::OutputSink& outputSink)
 {
 	// Get goals
 	nddlgen::types::GoalList goals = this->getInitialState()->getGoals();
@@ -148,9 +206,38 @@ void nddlgen::models::DomainDescriptionModel::generateGoals(std::ofstream& ofStr
 		// Print each line
 		foreach (std::string goalLine, goalLines)
 		{
-			wrln(0, goalLine, 1);
+			outputSink.writeLine(0, goalLine, 1);
 		}
 
-		wrel(1);
+		outputSink.writeEmptyLines(1);
 	}
 }
+
+void nddlgen::models::DomainDescriptionModel::setThreadPool(nddlgen::utilities::ThreadPoolPtr threadPool)
+{
+	this->_threadPool = threadPool;
+}
+
+void nddlgen::models::DomainDescriptionModel::nddlClassRenderingHelper(int index,
+		const std::vector<nddlgen::models::AbstractObjectModelPtr>& classes,
+		std::vector<std::string>& buffers)
+{
+	nddlgen::utilities::MemoryOutputSink outputSink;
+
+	classes[index]->generateNddlClass(outputSink);
+	outputSink.close();
+
+	outputSink.swapData(buffers[index]);
+}
+
+void nddlgen::models::DomainDescriptionModel::actionRenderingHelper(int index,
+		const std::vector<nddlgen::models::ActionModelPtr>& actions,
+		const std::string& armClass, std::vector<std::string>& buffers)
+{
+	nddlgen::utilities::MemoryOutputSink outputSink;
+
+	this->generateAction(actions[index], armClass, outputSink);
+	outputSink.close();
+
+	outputSink.swapData(buffers[index]);
+}
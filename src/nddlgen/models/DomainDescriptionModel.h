@@ -21,14 +21,21 @@
 #include <fstream>
 #include <list>
 #include <map>
+#include <string>
+#include <vector>
 
+#include <boost/bind.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include <nddlgen/controllers/CollisionDetectionController.h>
 #include <nddlgen/models/AbstractObjectModel.h>
+#include <nddlgen/models/BlockingMatrix.h>
 #include <nddlgen/models/DefaultArmModel.h>
 #include <nddlgen/models/InitialStateModel.h>
 #include <nddlgen/utilities/Foreach.hpp>
+#include <nddlgen/utilities/MemoryOutputSink.h>
+#include <nddlgen/utilities/OutputSink.h>
+#include <nddlgen/utilities/ThreadPool.h>
 #include <nddlgen/utilities/Types.hpp>
 
 namespace nddlgen
@@ -49,6 +56,46 @@ class nddlgen::models::DomainDescriptionModel
 		nddlgen::models::InitialStateModelPtr _initialState;
 		std::map<std::string, nddlgen::models::AbstractObjectModelPtr> _usedNddlClasses;
 		nddlgen::types::ActionList _actions;
+		nddlgen::models::BlockingMatrixPtr _blockingMatrix;
+
+		/**
+		 * Thread pool used to render NDDL classes and actions in parallel, or null if they
+		 * are rendered serially.
+		 */
+		nddlgen::utilities::ThreadPoolPtr _threadPool;
+
+		/**
+		 * Writes a single action as member function of the arm.
+		 *
+		 * @param action Action to write
+		 * @param armClass Class name of the arm
+		 * @param outputSink Output sink
+		 */
+		void generateAction(nddlgen::models::ActionModelPtr action, const std::string& armClass,
+				nddlgen::utilities::OutputSink& outputSink);
+
+		/**
+		 * Helper to render the NDDL class at the given index into its own buffer.
+		 *
+		 * @param index Index of the class
+		 * @param classes Classes to render
+		 * @param buffers Receives the rendered classes, indexed like the classes
+		 */
+		void nddlClassRenderingHelper(int index,
+				const std::vector<nddlgen::models::AbstractObjectModelPtr>& classes,
+				std::vector<std::string>& buffers);
+
+		/**
+		 * Helper to render the action at the given index into its own buffer.
+		 *
+		 * @param index Index of the action
+		 * @param actions Actions to render
+		 * @param armClass Class name of the arm
+		 * @param buffers Receives the rendered actions, indexed like the actions
+		 */
+		void actionRenderingHelper(int index,
+				const std::vector<nddlgen::models::ActionModelPtr>& actions,
+				const std::string& armClass, std::vector<std::string>& buffers);
 
 	public:
 
@@ -64,14 +111,33 @@ class nddlgen::models::DomainDescriptionModel
 		void addActions(nddlgen::types::ActionList actions);
 		nddlgen::types::ActionList getActions();
 
+		/**
+		 * Gets the blocking relations between all objects on the workspace. Object ids are the
+		 * indices within the objects of the workspace. The matrix is filled during collision
+		 * detection.
+		 *
+		 * @return Blocking matrix of the workspace objects.
+		 */
+		nddlgen::models::BlockingMatrixPtr getBlockingMatrix();
+
 		void addUsedNddlClass(nddlgen::models::AbstractObjectModelPtr object);
 
-		void generateForwardDeclarations(std::ofstream& ofStream);
-		void generateInstantiations(std::ofstream& ofStream);
-		void generateNddlClasses(std::ofstream& ofStream);
-		void generateActions(std::ofstream& ofStream);
-		void generateFacts(std::ofstream& ofStream);
-		void generateGoals(std::ofstream& ofStream);
+		/**
+		 * Sets a thread pool to render NDDL classes and actions in parallel. Each class and
+		 * each action is rendered into a buffer of its own, and the buffers are written in
+		 * the same order as without a thread pool, so the output does not change. Passing
+		 * null renders serially, which is the default.
+		 *
+		 * @param threadPool Thread pool, or null
+		 */
+		void setThreadPool(nddlgen::utilities::ThreadPoolPtr threadPool);
+
+		void generateForwardDeclarations(nddlgen::utilities::OutputSink& outputSink);
+		void generateInstantiations(nddlgen::utilities::OutputSink& outputSink);
+		void generateNddlClasses(nddlgen::utilities::OutputSink& outputSink);
+		void generateActions(nddlgen::utilities::OutputSink& outputSink);
+		void generateFacts(nddlgen::utilities::OutputSink& outputSink);
+		void generateGoals(nddlgen::utilities::OutputSink& outputSink);
 
 };
 
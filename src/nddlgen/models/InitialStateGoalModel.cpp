@@ -18,11 +18,6 @@
 
 nddlgen::models::InitialStateGoalModel::InitialStateGoalModel()
 {
-	this->_goalName = "";
-	this->_objectName = "";
-	this->_predicate = "";
-	this->_startsAfter = "";
-	this->_endsBefore = "";
 	this->_index = "";
 }
 
@@ -33,27 +28,27 @@ nddlgen::models::InitialStateGoalModel::~InitialStateGoalModel()
 
 void nddlgen::models::InitialStateGoalModel::setGoalName(std::string goalName)
 {
-	this->_goalName = goalName;
+	this->_goalName = InitialStateGoalModel::keepCopy(goalName, this->_goalNameCopy);
 }
 
 void nddlgen::models::InitialStateGoalModel::setObjectName(std::string objectName)
 {
-	this->_objectName = objectName;
+	this->_objectName = InitialStateGoalModel::keepCopy(objectName, this->_objectNameCopy);
 }
 
 void nddlgen::models::InitialStateGoalModel::setPredicate(std::string predicate)
 {
-	this->_predicate = predicate;
+	this->_predicate = InitialStateGoalModel::keepCopy(predicate, this->_predicateCopy);
 }
 
 void nddlgen::models::InitialStateGoalModel::setStartsAfter(std::string startsAfter)
 {
-	this->_startsAfter = startsAfter;
+	this->_startsAfter = InitialStateGoalModel::keepCopy(startsAfter, this->_startsAfterCopy);
 }
 
 void nddlgen::models::InitialStateGoalModel::setEndsBefore(std::string endsBefore)
 {
-	this->_endsBefore = endsBefore;
+	this->_endsBefore = InitialStateGoalModel::keepCopy(endsBefore, this->_endsBeforeCopy);
 }
 
 void nddlgen::models::InitialStateGoalModel::setIndex(int index)
@@ -61,6 +56,25 @@ void nddlgen::models::InitialStateGoalModel::setIndex(int index)
 	this->_index = boost::lexical_cast<std::string>(index);
 }
 
+void nddlgen::models::InitialStateGoalModel::setViews(boost::string_ref goalName,
+		boost::string_ref objectName, boost::string_ref predicate, boost::string_ref startsAfter,
+		boost::string_ref endsBefore, boost::shared_ptr<const void> buffer)
+{
+	this->_goalName = goalName;
+	this->_objectName = objectName;
+	this->_predicate = predicate;
+	this->_startsAfter = startsAfter;
+	this->_endsBefore = endsBefore;
+
+	// Keep the new buffer, and release copies and buffers of previous values
+	this->_viewBuffer = buffer;
+	this->_goalNameCopy.reset();
+	this->_objectNameCopy.reset();
+	this->_predicateCopy.reset();
+	this->_startsAfterCopy.reset();
+	this->_endsBeforeCopy.reset();
+}
+
 std::list<std::string> nddlgen::models::InitialStateGoalModel::getGoal()
 {
 	if (this->_index == "")
@@ -71,26 +85,60 @@ std::list<std::string> nddlgen::models::InitialStateGoalModel::getGoal()
 	std::list<std::string> goal;
 	std::string goalName;
 
-	if (this->_goalName != "")
+	if (!this->_goalName.empty())
 	{
-		goalName = this->_goalName;
+		goalName.assign(this->_goalName.data(), this->_goalName.size());
 	}
 	else
 	{
 		goalName = "goal" + this->_index;
 	}
 
-	goal.push_back("goal(" + this->_objectName + "." + this->_predicate + " " + goalName + ");");
-
-	if (this->_startsAfter != "")
+	// Build each line in place instead of concatenating temporaries
+	std::string line;
+	line.reserve(this->_objectName.size() + this->_predicate.size() + goalName.size() + 9);
+	line.append("goal(");
+	InitialStateGoalModel::append(line, this->_objectName);
+	line.append(".");
+	InitialStateGoalModel::append(line, this->_predicate);
+	line.append(" ");
+	line.append(goalName);
+	line.append(");");
+	goal.push_back(line);
+
+	if (!this->_startsAfter.empty())
 	{
-		goal.push_back(this->_startsAfter + " <= " + goalName + ".start" + ";");
+		line.clear();
+		InitialStateGoalModel::append(line, this->_startsAfter);
+		line.append(" <= ");
+		line.append(goalName);
+		line.append(".start;");
+		goal.push_back(line);
 	}
 
-	if (this->_endsBefore != "")
+	if (!this->_endsBefore.empty())
 	{
-		goal.push_back(goalName + ".end" + " <= " + this->_endsBefore + ";");
+		line.clear();
+		line.append(goalName);
+		line.append(".end <= ");
+		InitialStateGoalModel::append(line, this->_endsBefore);
+		line.append(";");
+		goal.push_back(line);
 	}
 
 	return goal;
 }
+
+boost::string_ref nddlgen::models::InitialStateGoalModel::keepCopy(const std::string& value,
+		boost::shared_ptr<const std::string>& copy)
+{
+	// Replaces the previous copy of the field, if any
+	copy.reset(new std::string(value));
+
+	return boost::string_ref(*copy);
+}
+
+void nddlgen::models::InitialStateGoalModel::append(std::string& line, boost::string_ref value)
+{
+	line.append(value.data(), value.size());
+}
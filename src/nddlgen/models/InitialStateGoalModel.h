@@ -22,6 +22,7 @@
 
 #include <boost/shared_ptr.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/utility/string_ref.hpp>
 
 #include <nddlgen/exceptions/NoIndexSetException.hpp>
 
@@ -39,13 +40,28 @@ class nddlgen::models::InitialStateGoalModel
 
 	private:
 
-		std::string _goalName;
-		std::string _objectName;
-		std::string _predicate;
-		std::string _startsAfter;
-		std::string _endsBefore;
+		boost::string_ref _goalName;
+		boost::string_ref _objectName;
+		boost::string_ref _predicate;
+		boost::string_ref _startsAfter;
+		boost::string_ref _endsBefore;
 		std::string _index;
 
+		// Copies the fields point into if they were set by a setter. Setting a field again
+		// replaces its copy
+		boost::shared_ptr<const std::string> _goalNameCopy;
+		boost::shared_ptr<const std::string> _objectNameCopy;
+		boost::shared_ptr<const std::string> _predicateCopy;
+		boost::shared_ptr<const std::string> _startsAfterCopy;
+		boost::shared_ptr<const std::string> _endsBeforeCopy;
+
+		// Buffer the fields point into if they were set by setViews()
+		boost::shared_ptr<const void> _viewBuffer;
+
+		static boost::string_ref keepCopy(const std::string& value, boost::shared_ptr<const std::string>& copy);
+
+		static void append(std::string& line, boost::string_ref value);
+
 	public:
 
 		InitialStateGoalModel();
@@ -58,6 +74,12 @@ class nddlgen::models::InitialStateGoalModel
 		void setEndsBefore(std::string endsBefore);
 		void setIndex(int index);
 
+		// Sets all fields without copying them. The buffer they point into is kept alive
+		// as long as this goal
+		void setViews(boost::string_ref goalName, boost::string_ref objectName,
+				boost::string_ref predicate, boost::string_ref startsAfter,
+				boost::string_ref endsBefore, boost::shared_ptr<const void> buffer);
+
 		std::list<std::string> getGoal();
 
 };
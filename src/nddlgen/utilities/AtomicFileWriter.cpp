@@ -0,0 +1,165 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/utilities/AtomicFileWriter.h>
+
+nddlgen::utilities::AtomicFileWriter::AtomicFileWriter(const std::string& fileName)
+{
+	this->_fileName = fileName;
+}
+
+nddlgen::utilities::AtomicFileWriter::~AtomicFileWriter()
+{
+
+}
+
+void nddlgen::utilities::AtomicFileWriter::append(const char* data, std::size_t size)
+{
+	// Empty parts would only lengthen the vectored write
+	if (size == 0)
+	{
+		return;
+	}
+
+	struct iovec part;
+	part.iov_base = const_cast<char*>(data);
+	part.iov_len = size;
+
+	this->_parts.push_back(part);
+}
+
+void nddlgen::utilities::AtomicFileWriter::append(const std::string& data)
+{
+	this->append(data.data(), data.size());
+}
+
+void nddlgen::utilities::AtomicFileWriter::commit(bool synchronize)
+{
+	boost::filesystem::path file(this->_fileName);
+	boost::system::error_code error;
+
+	// Write under a temporary name within the same directory, so renaming is atomic
+	boost::filesystem::path temporaryFile = file.parent_path()
+			/ boost::filesystem::unique_path(file.filename().string() + ".%%%%-%%%%-%%%%.tmp", error);
+
+	if (error)
+	{
+		throw nddlgen::exceptions::WritingOutputFileException(this->_fileName, error.message());
+	}
+
+	int temporary = open(temporaryFile.string().c_str(), O_WRONLY | O_CREAT | O_EXCL, 0666);
+
+	if (temporary == -1)
+	{
+		throw nddlgen::exceptions::WritingOutputFileException(this->_fileName, strerror(errno));
+	}
+
+	int writeError = 0;
+	struct stat existingFile;
+
+	// Keep the permissions of a replaced file instead of the default ones of a new file
+	if (stat(this->_fileName.c_str(), &existingFile) == 0
+			&& fchmod(temporary, existingFile.st_mode & 07777) == -1)
+	{
+		writeError = errno;
+	}
+	else if (!this->writePartsHelper(temporary) || (synchronize && fsync(temporary) == -1))
+	{
+		writeError = errno;
+	}
+
+	if (close(temporary) == -1 && writeError == 0)
+	{
+		writeError = errno;
+	}
+
+	if (writeError == 0)
+	{
+		if (rename(temporaryFile.string().c_str(), this->_fileName.c_str()) == 0)
+		{
+			if (synchronize)
+			{
+				this->directorySyncingHelper();
+			}
+
+			return;
+		}
+
+		writeError = errno;
+	}
+
+	// Leave the existing file untouched
+	unlink(temporaryFile.string().c_str());
+
+	throw nddlgen::exceptions::WritingOutputFileException(this->_fileName, strerror(writeError));
+}
+
+bool nddlgen::utilities::AtomicFileWriter::writePartsHelper(int file)
+{
+	std::size_t next = 0;
+
+	// Usually a single call writes everything, but writes may be partial or interrupted, and
+	// the amount of parts per call is limited
+	while (next < this->_parts.size())
+	{
+		int count = (int) std::min<std::size_t>(this->_parts.size() - next, IOV_MAX);
+		ssize_t written = writev(file, &this->_parts[next], count);
+
+		if (written == -1)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			return false;
+		}
+
+		// Skip completely written parts and advance into a partially written one
+		while (next < this->_parts.size() && (std::size_t) written >= this->_parts[next].iov_len)
+		{
+			written -= this->_parts[next].iov_len;
+			next++;
+		}
+
+		if (written > 0)
+		{
+			this->_parts[next].iov_base = static_cast<char*>(this->_parts[next].iov_base) + written;
+			this->_parts[next].iov_len -= written;
+		}
+	}
+
+	return true;
+}
+
+void nddlgen::utilities::AtomicFileWriter::directorySyncingHelper()
+{
+	std::string directory = boost::filesystem::path(this->_fileName).parent_path().string();
+
+	if (directory == "")
+	{
+		directory = ".";
+	}
+
+	int file = open(directory.c_str(), O_RDONLY);
+
+	// The file is replaced already, so failing to flush its directory is not reported
+	if (file != -1)
+	{
+		fsync(file);
+		close(file);
+	}
+}
@@ -0,0 +1,130 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_UTILITIES_ATOMICFILEWRITER_H_
+#define NDDLGEN_UTILITIES_ATOMICFILEWRITER_H_
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <nddlgen/exceptions/WritingOutputFileException.hpp>
+
+namespace nddlgen
+{
+	namespace utilities
+	{
+		class AtomicFileWriter;
+		typedef boost::shared_ptr<nddlgen::utilities::AtomicFileWriter> AtomicFileWriterPtr;
+	}
+}
+
+/**
+ * Replaces a file atomically. The content is collected as a list of parts, written to a
+ * temporary file within the same directory using a single vectored write, and renamed
+ * into place, so readers either see the old or the new file, but never a truncated one.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::utilities::AtomicFileWriter
+{
+
+	private:
+
+		/**
+		 * Path and name of the file to replace.
+		 */
+		std::string _fileName;
+
+		/**
+		 * Parts of the content, in order. They are not copied.
+		 */
+		std::vector<struct iovec> _parts;
+
+		/**
+		 * Writes all parts to a file descriptor, resuming partial writes.
+		 *
+		 * @param file File descriptor
+		 *
+		 * @return True, if all parts were written, false if not. errno is set on failure.
+		 */
+		bool writePartsHelper(int file);
+
+		/**
+		 * Flushes the directory of the file to disk, so the rename survives a crash.
+		 */
+		void directorySyncingHelper();
+
+	public:
+
+		/**
+		 * Constructs a new writer for the given file, which is not touched before commit()
+		 * is called.
+		 *
+		 * @param fileName Path and name of the file to replace
+		 */
+		AtomicFileWriter(const std::string& fileName);
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~AtomicFileWriter();
+
+		/**
+		 * Appends a part to the content. The data is not copied and must stay valid until
+		 * commit() returns.
+		 *
+		 * @param data First character
+		 * @param size Amount of characters
+		 */
+		void append(const char* data, std::size_t size);
+
+		/**
+		 * Appends a part to the content. The string is not copied and must neither change
+		 * nor be destroyed until commit() returns.
+		 *
+		 * @param data Text
+		 */
+		void append(const std::string& data);
+
+		/**
+		 * Writes the content to a temporary file and renames it to the file name. The
+		 * temporary file is removed on failure, leaving the existing file untouched. A
+		 * replaced file keeps its permissions, but its owner and group become those of the
+		 * writing process.
+		 *
+		 * @param synchronize True to flush the file and its directory to disk before and after
+		 * 		renaming, false to leave that to the operating system
+		 *
+		 * @throws WritingOutputFileException if the file can not be written.
+		 */
+		void commit(bool synchronize);
+
+};
+
+#endif
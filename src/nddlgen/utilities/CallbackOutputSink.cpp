@@ -0,0 +1,39 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/utilities/CallbackOutputSink.h>
+
+nddlgen::utilities::CallbackOutputSink::CallbackOutputSink(Callback callback)
+	: nddlgen::utilities::OutputSink(OutputSink::DEFAULT_BLOCK_SIZE)
+{
+	this->_callback = callback;
+}
+
+nddlgen::utilities::CallbackOutputSink::CallbackOutputSink(Callback callback, std::size_t chunkSize)
+	: nddlgen::utilities::OutputSink(chunkSize)
+{
+	this->_callback = callback;
+}
+
+nddlgen::utilities::CallbackOutputSink::~CallbackOutputSink()
+{
+
+}
+
+void nddlgen::utilities::CallbackOutputSink::writeBlock(const char* data, std::size_t size)
+{
+	this->_callback(data, size);
+}
@@ -0,0 +1,94 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_UTILITIES_CALLBACKOUTPUTSINK_H_
+#define NDDLGEN_UTILITIES_CALLBACKOUTPUTSINK_H_
+
+#include <cstddef>
+#include <string>
+
+#include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <nddlgen/utilities/OutputSink.h>
+
+namespace nddlgen
+{
+	namespace utilities
+	{
+		class CallbackOutputSink;
+		typedef boost::shared_ptr<nddlgen::utilities::CallbackOutputSink> CallbackOutputSinkPtr;
+	}
+}
+
+/**
+ * Output sink handing the text to a callback in chunks of a fixed size. Only the last
+ * chunk may be smaller.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::utilities::CallbackOutputSink : public nddlgen::utilities::OutputSink
+{
+
+	public:
+
+		/**
+		 * Callback receiving a chunk of text. The text is only valid during the call.
+		 */
+		typedef boost::function<void (const char* data, std::size_t size)> Callback;
+
+	private:
+
+		/**
+		 * Callback receiving the chunks.
+		 */
+		Callback _callback;
+
+	protected:
+
+		/**
+		 * Hands a chunk to the callback.
+		 *
+		 * @param data First character
+		 * @param size Amount of characters
+		 */
+		virtual void writeBlock(const char* data, std::size_t size);
+
+	public:
+
+		/**
+		 * Constructs a new callback output sink with chunks of 64 KiB.
+		 *
+		 * @param callback Callback receiving the chunks
+		 */
+		CallbackOutputSink(Callback callback);
+
+		/**
+		 * Constructs a new callback output sink.
+		 *
+		 * @param callback Callback receiving the chunks
+		 * @param chunkSize Size of the chunks in bytes
+		 */
+		CallbackOutputSink(Callback callback, std::size_t chunkSize);
+
+		/**
+		 * Destructor to free memory. Text not written by close() is not handed to the callback.
+		 */
+		virtual ~CallbackOutputSink();
+
+};
+
+#endif
@@ -0,0 +1,85 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/utilities/ContentHash.h>
+
+nddlgen::utilities::ContentHash::ContentHash()
+{
+	// FNV-1a 64 bit offset basis
+	this->_value = 14695981039346656037ULL;
+	this->_checksum = 0;
+}
+
+nddlgen::utilities::ContentHash::~ContentHash()
+{
+
+}
+
+void nddlgen::utilities::ContentHash::update(const char* data, std::size_t size)
+{
+	const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+	boost::uint64_t value = this->_value;
+	boost::uint64_t checksum = this->_checksum;
+
+	for (std::size_t i = 0; i < size; i++)
+	{
+		// FNV-1a 64 bit prime
+		value ^= bytes[i];
+		value *= 1099511628211ULL;
+
+		// Golden ratio multiplier, the shift mixes the high bits back into the low ones
+		checksum += bytes[i] + 1;
+		checksum *= 0x9e3779b97f4a7c15ULL;
+		checksum ^= checksum >> 32;
+	}
+
+	this->_value = value;
+	this->_checksum = checksum;
+}
+
+void nddlgen::utilities::ContentHash::update(const std::string& value)
+{
+	this->update((boost::uint64_t) value.size());
+	this->update(value.data(), value.size());
+}
+
+void nddlgen::utilities::ContentHash::update(boost::uint64_t value)
+{
+	this->update(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+boost::uint64_t nddlgen::utilities::ContentHash::getValue() const
+{
+	return this->_value;
+}
+
+boost::uint64_t nddlgen::utilities::ContentHash::getChecksum() const
+{
+	return this->_checksum;
+}
+
+std::string nddlgen::utilities::ContentHash::toString() const
+{
+	static const char digits[] = "0123456789abcdef";
+	std::string text(16, '0');
+
+	for (int i = 0; i < 16; i++)
+	{
+		text[15 - i] = digits[(this->_value >> (4 * i)) & 0xf];
+	}
+
+	return text;
+}
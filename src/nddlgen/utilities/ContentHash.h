@@ -0,0 +1,114 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_UTILITIES_CONTENTHASH_H_
+#define NDDLGEN_UTILITIES_CONTENTHASH_H_
+
+#include <cstddef>
+#include <string>
+
+#include <boost/cstdint.hpp>
+
+namespace nddlgen
+{
+	namespace utilities
+	{
+		class ContentHash;
+	}
+}
+
+/**
+ * Incremental 64 bit FNV-1a hash to identify contents, e.g. of input files. A second,
+ * independent 64 bit checksum of the same content is computed alongside, to tell contents
+ * apart whose hash values collide. Not suitable for anything security related.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::utilities::ContentHash
+{
+
+	private:
+
+		/**
+		 * Hash of everything added so far.
+		 */
+		boost::uint64_t _value;
+
+		/**
+		 * Checksum of everything added so far, computed with a multiply and shift mix per
+		 * byte instead of FNV-1a.
+		 */
+		boost::uint64_t _checksum;
+
+	public:
+
+		/**
+		 * Constructs a new hash of no content.
+		 */
+		ContentHash();
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~ContentHash();
+
+		/**
+		 * Adds raw bytes to the hashed content.
+		 *
+		 * @param data First byte
+		 * @param size Amount of bytes
+		 */
+		void update(const char* data, std::size_t size);
+
+		/**
+		 * Adds a string to the hashed content. The length is added as well, so consecutive
+		 * strings can not be confused with a different split of the same characters.
+		 *
+		 * @param value String
+		 */
+		void update(const std::string& value);
+
+		/**
+		 * Adds the bytes of a number to the hashed content.
+		 *
+		 * @param value Number
+		 */
+		void update(boost::uint64_t value);
+
+		/**
+		 * Gets the hash of everything added so far.
+		 *
+		 * @return Hash value.
+		 */
+		boost::uint64_t getValue() const;
+
+		/**
+		 * Gets the independent checksum of everything added so far.
+		 *
+		 * @return Checksum.
+		 */
+		boost::uint64_t getChecksum() const;
+
+		/**
+		 * Gets the hash of everything added so far as text.
+		 *
+		 * @return Hash value as 16 lower case hexadecimal digits.
+		 */
+		std::string toString() const;
+
+};
+
+#endif
@@ -0,0 +1,79 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/utilities/FileOutputSink.h>
+
+nddlgen::utilities::FileOutputSink::FileOutputSink(const std::string& fileName)
+	: nddlgen::utilities::OutputSink(OutputSink::DEFAULT_BLOCK_SIZE)
+{
+	this->_fileName = fileName;
+	this->_file = open(fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+
+	if (this->_file == -1)
+	{
+		throw nddlgen::exceptions::WritingOutputFileException(fileName, strerror(errno));
+	}
+}
+
+nddlgen::utilities::FileOutputSink::~FileOutputSink()
+{
+	try
+	{
+		this->close();
+	}
+	catch (const nddlgen::exceptions::WritingOutputFileException&)
+	{
+		// Destructors must not throw
+	}
+
+	if (this->_file != -1)
+	{
+		::close(this->_file);
+	}
+}
+
+void nddlgen::utilities::FileOutputSink::writeBlock(const char* data, std::size_t size)
+{
+	// Writes may be partial or interrupted
+	while (size > 0)
+	{
+		ssize_t written = ::write(this->_file, data, size);
+
+		if (written == -1)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			throw nddlgen::exceptions::WritingOutputFileException(this->_fileName, strerror(errno));
+		}
+
+		data += written;
+		size -= written;
+	}
+}
+
+void nddlgen::utilities::FileOutputSink::finish()
+{
+	int result = ::close(this->_file);
+	this->_file = -1;
+
+	if (result == -1)
+	{
+		throw nddlgen::exceptions::WritingOutputFileException(this->_fileName, strerror(errno));
+	}
+}
@@ -0,0 +1,100 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_UTILITIES_FILEOUTPUTSINK_H_
+#define NDDLGEN_UTILITIES_FILEOUTPUTSINK_H_
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include <nddlgen/exceptions/WritingOutputFileException.hpp>
+#include <nddlgen/utilities/OutputSink.h>
+
+namespace nddlgen
+{
+	namespace utilities
+	{
+		class FileOutputSink;
+		typedef boost::shared_ptr<nddlgen::utilities::FileOutputSink> FileOutputSinkPtr;
+	}
+}
+
+/**
+ * Output sink writing to a file, a whole block per write call.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::utilities::FileOutputSink : public nddlgen::utilities::OutputSink
+{
+
+	private:
+
+		/**
+		 * Path and name of the output file.
+		 */
+		std::string _fileName;
+
+		/**
+		 * Descriptor of the output file, or -1 if it is closed.
+		 */
+		int _file;
+
+	protected:
+
+		/**
+		 * Writes a block to the file.
+		 *
+		 * @param data First character
+		 * @param size Amount of characters
+		 *
+		 * @throws WritingOutputFileException if writing fails.
+		 */
+		virtual void writeBlock(const char* data, std::size_t size);
+
+		/**
+		 * Closes the file.
+		 *
+		 * @throws WritingOutputFileException if closing fails.
+		 */
+		virtual void finish();
+
+	public:
+
+		/**
+		 * Opens an output file, replacing its content.
+		 *
+		 * @param fileName Path and name of the output file
+		 *
+		 * @throws WritingOutputFileException if the file can not be opened.
+		 */
+		FileOutputSink(const std::string& fileName);
+
+		/**
+		 * Destructor to close the file, writing all buffered text if close() was not called.
+		 * Errors are ignored.
+		 */
+		virtual ~FileOutputSink();
+
+};
+
+#endif
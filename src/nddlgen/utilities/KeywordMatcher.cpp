@@ -0,0 +1,162 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/utilities/KeywordMatcher.h>
+
+nddlgen::utilities::KeywordMatcher::KeywordMatcher()
+{
+	this->compile(std::vector<std::string>());
+}
+
+nddlgen::utilities::KeywordMatcher::~KeywordMatcher()
+{
+
+}
+
+void nddlgen::utilities::KeywordMatcher::compile(const std::vector<std::string>& keywords)
+{
+	// Compare keywords by length first and by lower case text second, so the best match is
+	// the one of highest rank
+	std::vector<std::pair<std::pair<std::size_t, std::string>, int> > order;
+
+	for (int i = 0; i < (int) keywords.size(); i++)
+	{
+		std::string keyword = boost::algorithm::to_lower_copy(keywords[i]);
+		order.push_back(std::make_pair(std::make_pair(keyword.size(), keyword), i));
+	}
+
+	std::sort(order.begin(), order.end());
+
+	std::vector<int> keywordRanks(keywords.size());
+	this->_ranks.assign(keywords.size(), 0);
+
+	for (int rank = 0; rank < (int) order.size(); rank++)
+	{
+		this->_ranks[rank] = order[rank].second;
+		keywordRanks[order[rank].second] = rank;
+	}
+
+	// Give each byte occurring in a keyword its own class
+	this->_classCount = 1;
+	this->_byteClasses.assign(256, 0);
+
+	for (int rank = 0; rank < (int) order.size(); rank++)
+	{
+		const std::string& keyword = order[rank].first.second;
+
+		for (std::size_t i = 0; i < keyword.size(); i++)
+		{
+			int& byteClass = this->_byteClasses[(unsigned char) keyword[i]];
+
+			if (byteClass == 0)
+			{
+				byteClass = this->_classCount++;
+			}
+		}
+	}
+
+	// Fold case, so upper case bytes share the class of their lower case counterpart
+	for (int byte = 0; byte < 256; byte++)
+	{
+		std::string lowerCase = boost::algorithm::to_lower_copy(std::string(1, (char) byte));
+		this->_byteClasses[byte] = this->_byteClasses[(unsigned char) lowerCase[0]];
+	}
+
+	// Build the trie of all keywords, with -1 for missing transitions
+	this->_transitions.assign(this->_classCount, -1);
+	this->_matches.assign(1, -1);
+
+	for (int rank = 0; rank < (int) order.size(); rank++)
+	{
+		const std::string& keyword = order[rank].first.second;
+		int state = 0;
+
+		for (std::size_t i = 0; i < keyword.size(); i++)
+		{
+			int index = state * this->_classCount + this->_byteClasses[(unsigned char) keyword[i]];
+
+			if (this->_transitions[index] == -1)
+			{
+				this->_transitions[index] = (int) this->_matches.size();
+				this->_transitions.resize(this->_transitions.size() + this->_classCount, -1);
+				this->_matches.push_back(-1);
+			}
+
+			state = this->_transitions[index];
+		}
+
+		// Duplicate keywords keep the higher rank
+		this->_matches[state] = std::max(this->_matches[state], rank);
+	}
+
+	// Turn the trie into an automaton in breadth first order. Missing transitions continue
+	// from the failure state, i.e. the longest proper suffix which is a prefix of a keyword,
+	// and each state inherits the matches of its failure state
+	std::vector<int> failures(this->_matches.size(), 0);
+	std::deque<int> queue;
+
+	for (int byteClass = 0; byteClass < this->_classCount; byteClass++)
+	{
+		int& next = this->_transitions[byteClass];
+
+		if (next == -1)
+		{
+			next = 0;
+		}
+		else
+		{
+			queue.push_back(next);
+		}
+	}
+
+	while (!queue.empty())
+	{
+		int state = queue.front();
+		queue.pop_front();
+
+		this->_matches[state] = std::max(this->_matches[state], this->_matches[failures[state]]);
+
+		for (int byteClass = 0; byteClass < this->_classCount; byteClass++)
+		{
+			int& next = this->_transitions[state * this->_classCount + byteClass];
+			int failureNext = this->_transitions[failures[state] * this->_classCount + byteClass];
+
+			if (next == -1)
+			{
+				next = failureNext;
+			}
+			else
+			{
+				failures[next] = failureNext;
+				queue.push_back(next);
+			}
+		}
+	}
+}
+
+int nddlgen::utilities::KeywordMatcher::findLongest(const std::string& text) const
+{
+	int state = 0;
+	int best = this->_matches[0];
+
+	for (std::size_t i = 0; i < text.size(); i++)
+	{
+		state = this->_transitions[state * this->_classCount + this->_byteClasses[(unsigned char) text[i]]];
+		best = std::max(best, this->_matches[state]);
+	}
+
+	return (best == -1) ? -1 : this->_ranks[best];
+}
@@ -0,0 +1,109 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_UTILITIES_KEYWORDMATCHER_H_
+#define NDDLGEN_UTILITIES_KEYWORDMATCHER_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace nddlgen
+{
+	namespace utilities
+	{
+		class KeywordMatcher;
+		typedef boost::shared_ptr<nddlgen::utilities::KeywordMatcher> KeywordMatcherPtr;
+	}
+}
+
+/**
+ * Finds the longest of a set of keywords contained in a text, ignoring case. The keywords are
+ * compiled into an Aho-Corasick automaton, so a text is matched against all keywords in a
+ * single pass, regardless of their amount. Matching does not modify the matcher, so it can be
+ * done concurrently.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::utilities::KeywordMatcher
+{
+
+	private:
+
+		/**
+		 * Amount of byte classes. Bytes not occurring in any keyword share class 0.
+		 */
+		int _classCount;
+
+		/**
+		 * Byte class of each (case folded) byte.
+		 */
+		std::vector<int> _byteClasses;
+
+		/**
+		 * Next state for each state and byte class, indexed by state * _classCount + class.
+		 */
+		std::vector<int> _transitions;
+
+		/**
+		 * Best keyword ending in each state, or -1 if none. Keywords are compared by length
+		 * first and by their lower case text second.
+		 */
+		std::vector<int> _matches;
+
+		/**
+		 * Ranks of the keywords in the order matches are compared in.
+		 */
+		std::vector<int> _ranks;
+
+	public:
+
+		/**
+		 * Constructs a new matcher without keywords.
+		 */
+		KeywordMatcher();
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~KeywordMatcher();
+
+		/**
+		 * Compiles keywords into the matcher, replacing the ones compiled before.
+		 *
+		 * @param keywords Keywords
+		 */
+		void compile(const std::vector<std::string>& keywords);
+
+		/**
+		 * Finds the longest keyword contained in a text, ignoring case. Of several keywords
+		 * of the same length, the lexicographically greatest lower case one is found.
+		 *
+		 * @param text Text
+		 *
+		 * @return Index of the keyword, or -1 if no keyword is contained.
+		 */
+		int findLongest(const std::string& text) const;
+
+};
+
+#endif
@@ -0,0 +1,98 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/utilities/MappedFile.h>
+
+nddlgen::utilities::MappedFile::MappedFile(const std::string& fileName)
+{
+	this->_data = "";
+	this->_size = 0;
+	this->_mappingSize = 0;
+
+	int file = open(fileName.c_str(), O_RDONLY);
+
+	if (file == -1)
+	{
+		throw nddlgen::exceptions::MappingFileException(fileName, strerror(errno));
+	}
+
+	struct stat status;
+
+	if (fstat(file, &status) == -1)
+	{
+		int error = errno;
+		close(file);
+		throw nddlgen::exceptions::MappingFileException(fileName, strerror(error));
+	}
+
+	// Empty files can not be mapped, and are represented by an empty string
+	if (status.st_size == 0)
+	{
+		close(file);
+		return;
+	}
+
+	// Reserve the file size rounded up to whole pages plus one more page. The file is mapped
+	// over the beginning, the rest stays zero, so the content is always null terminated
+	std::size_t pageSize = sysconf(_SC_PAGESIZE);
+	std::size_t size = status.st_size;
+	std::size_t mappingSize = (size / pageSize + 1) * pageSize;
+
+	void* mapping = mmap(0, mappingSize, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (mapping == MAP_FAILED)
+	{
+		int error = errno;
+		close(file);
+		throw nddlgen::exceptions::MappingFileException(fileName, strerror(error));
+	}
+
+	if (mmap(mapping, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, file, 0) == MAP_FAILED)
+	{
+		int error = errno;
+		munmap(mapping, mappingSize);
+		close(file);
+		throw nddlgen::exceptions::MappingFileException(fileName, strerror(error));
+	}
+
+	// The mapping stays valid after closing the file
+	close(file);
+
+	// The file is read once from start to end
+	madvise(mapping, size, MADV_SEQUENTIAL);
+
+	this->_data = static_cast<const char*>(mapping);
+	this->_size = size;
+	this->_mappingSize = mappingSize;
+}
+
+nddlgen::utilities::MappedFile::~MappedFile()
+{
+	if (this->_mappingSize > 0)
+	{
+		munmap(const_cast<char*>(this->_data), this->_mappingSize);
+	}
+}
+
+const char* nddlgen::utilities::MappedFile::getData() const
+{
+	return this->_data;
+}
+
+std::size_t nddlgen::utilities::MappedFile::getSize() const
+{
+	return this->_size;
+}
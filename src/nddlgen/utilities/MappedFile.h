@@ -0,0 +1,107 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_UTILITIES_MAPPEDFILE_H_
+#define NDDLGEN_UTILITIES_MAPPEDFILE_H_
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include <nddlgen/exceptions/MappingFileException.hpp>
+
+namespace nddlgen
+{
+	namespace utilities
+	{
+		class MappedFile;
+		typedef boost::shared_ptr<nddlgen::utilities::MappedFile> MappedFilePtr;
+	}
+}
+
+/**
+ * Read only view of a whole file, mapped into memory instead of copied. The content is
+ * followed by a null character, so it can be handed to parsers expecting a C string.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::utilities::MappedFile
+{
+
+	private:
+
+		/**
+		 * First byte of the content.
+		 */
+		const char* _data;
+
+		/**
+		 * Size of the content in bytes, without the terminating null character.
+		 */
+		std::size_t _size;
+
+		/**
+		 * Size of the whole mapping in bytes, or 0 if nothing is mapped.
+		 */
+		std::size_t _mappingSize;
+
+		/**
+		 * Mapped files can not be copied.
+		 */
+		MappedFile(const MappedFile& other);
+		MappedFile& operator=(const MappedFile& other);
+
+	public:
+
+		/**
+		 * Maps a file into memory.
+		 *
+		 * @param fileName Path and name of the file
+		 *
+		 * @throws MappingFileException if the file can not be opened or mapped.
+		 */
+		MappedFile(const std::string& fileName);
+
+		/**
+		 * Destructor to unmap the file.
+		 */
+		virtual ~MappedFile();
+
+		/**
+		 * Gets the content of the file.
+		 *
+		 * @return Content, followed by a null character.
+		 */
+		const char* getData() const;
+
+		/**
+		 * Gets the size of the file.
+		 *
+		 * @return Size in bytes, without the terminating null character.
+		 */
+		std::size_t getSize() const;
+
+};
+
+#endif
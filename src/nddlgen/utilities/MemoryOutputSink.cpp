@@ -0,0 +1,57 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/utilities/MemoryOutputSink.h>
+
+nddlgen::utilities::MemoryOutputSink::MemoryOutputSink()
+	: nddlgen::utilities::OutputSink(std::string::npos)
+{
+
+}
+
+nddlgen::utilities::MemoryOutputSink::~MemoryOutputSink()
+{
+
+}
+
+const std::string& nddlgen::utilities::MemoryOutputSink::getData()
+{
+	return this->_data;
+}
+
+void nddlgen::utilities::MemoryOutputSink::swapData(std::string& data)
+{
+	this->_data.swap(data);
+}
+
+void nddlgen::utilities::MemoryOutputSink::writeBlock(const char* data, std::size_t size)
+{
+	this->_data.append(data, size);
+}
+
+void nddlgen::utilities::MemoryOutputSink::writeLastBlock(std::string& buffer)
+{
+	// Blocks are unlimited, so all text arrives at once when the sink is closed, and the
+	// buffer simply becomes the data
+	if (this->_data.empty())
+	{
+		this->_data.swap(buffer);
+	}
+	else
+	{
+		this->_data.append(buffer);
+	}
+}
@@ -0,0 +1,97 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_UTILITIES_MEMORYOUTPUTSINK_H_
+#define NDDLGEN_UTILITIES_MEMORYOUTPUTSINK_H_
+
+#include <cstddef>
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+
+#include <nddlgen/utilities/OutputSink.h>
+
+namespace nddlgen
+{
+	namespace utilities
+	{
+		class MemoryOutputSink;
+		typedef boost::shared_ptr<nddlgen::utilities::MemoryOutputSink> MemoryOutputSinkPtr;
+	}
+}
+
+/**
+ * Output sink collecting all text in a growing memory buffer.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::utilities::MemoryOutputSink : public nddlgen::utilities::OutputSink
+{
+
+	private:
+
+		/**
+		 * Text written so far.
+		 */
+		std::string _data;
+
+	protected:
+
+		/**
+		 * Appends a block to the memory buffer.
+		 *
+		 * @param data First character
+		 * @param size Amount of characters
+		 */
+		virtual void writeBlock(const char* data, std::size_t size);
+
+		/**
+		 * Takes the remaining text over without copying it, if nothing was written before.
+		 *
+		 * @param buffer Remaining text, which is left empty or unchanged
+		 */
+		virtual void writeLastBlock(std::string& buffer);
+
+	public:
+
+		/**
+		 * Constructs a new, empty memory output sink.
+		 */
+		MemoryOutputSink();
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~MemoryOutputSink();
+
+		/**
+		 * Gets the text written to the sink. Complete after close() was called.
+		 *
+		 * @return Text.
+		 */
+		const std::string& getData();
+
+		/**
+		 * Exchanges the text written to the sink with the given string, to take it over
+		 * without copying it. Complete after close() was called.
+		 *
+		 * @param data Receives the text, its previous content is left in the sink
+		 */
+		void swapData(std::string& data);
+
+};
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/utilities/NumericTupleParser.h>
+
+void nddlgen::utilities::NumericTupleParser::parse(const std::string& source, double* values, int count)
+{
+	const char* position = source.c_str();
+
+	for (int i = 0; i < count; i++)
+	{
+		// Skip separators in front of the number
+		while (NumericTupleParser::isSeparator(*position))
+		{
+			position++;
+		}
+
+		if (*position == '\0')
+		{
+			throw nddlgen::exceptions::MalformedNumericTupleException(source, "expected "
+					+ boost::lexical_cast<std::string>(count) + " values, but got "
+					+ boost::lexical_cast<std::string>(i));
+		}
+
+		// Convert number directly from the source string
+		char* end;
+
+		errno = 0;
+		values[i] = strtod(position, &end);
+
+		// A number must be followed by a separator or the end of the string
+		if (end == position || (*end != '\0' && !NumericTupleParser::isSeparator(*end)))
+		{
+			const char* tokenEnd = position;
+
+			while (*tokenEnd != '\0' && !NumericTupleParser::isSeparator(*tokenEnd))
+			{
+				tokenEnd++;
+			}
+
+			throw nddlgen::exceptions::MalformedNumericTupleException(source, "\""
+					+ std::string(position, tokenEnd) + "\" is not a number");
+		}
+
+		// Values too small to be represented are rounded to zero, but too large ones are an error
+		if (errno == ERANGE && (values[i] == HUGE_VAL || values[i] == -HUGE_VAL))
+		{
+			throw nddlgen::exceptions::MalformedNumericTupleException(source, "\""
+					+ std::string(position, end - position) + "\" is out of range");
+		}
+
+		position = end;
+	}
+
+	// Nothing but separators may follow the last number
+	while (NumericTupleParser::isSeparator(*position))
+	{
+		position++;
+	}
+
+	if (*position != '\0')
+	{
+		throw nddlgen::exceptions::MalformedNumericTupleException(source, "expected "
+				+ boost::lexical_cast<std::string>(count) + " values, but got more");
+	}
+}
+
+bool nddlgen::utilities::NumericTupleParser::isSeparator(char character)
+{
+	return character == ' ' || character == '\t' || character == '\n' || character == '\r';
+}
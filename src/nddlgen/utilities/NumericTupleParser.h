@@ -0,0 +1,67 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_UTILITIES_NUMERICTUPLEPARSER_H_
+#define NDDLGEN_UTILITIES_NUMERICTUPLEPARSER_H_
+
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+#include <boost/lexical_cast.hpp>
+
+#include <nddlgen/exceptions/MalformedNumericTupleException.hpp>
+
+namespace nddlgen { namespace utilities { class NumericTupleParser; }}
+
+/**
+ * Parses tuples of whitespace separated numbers as used in SDF, e.g. the 6 values of a pose
+ * or the 3 values of a size. Numbers are converted in place from the source string, so
+ * nothing is allocated unless the input is malformed.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::utilities::NumericTupleParser
+{
+
+	public:
+
+		/**
+		 * Parses exactly count numbers from source.
+		 *
+		 * @param source String holding the numbers, separated by whitespace
+		 * @param values Receives the parsed numbers, must hold at least count values
+		 * @param count Amount of numbers expected
+		 *
+		 * @throws MalformedNumericTupleException if source holds less or more numbers than
+		 * expected, or a token is not a number.
+		 */
+		static void parse(const std::string& source, double* values, int count);
+
+	private:
+
+		NumericTupleParser();
+		~NumericTupleParser();
+
+		/**
+		 * Tests if a character separates two numbers.
+		 */
+		static bool isSeparator(char character);
+
+};
+
+#endif
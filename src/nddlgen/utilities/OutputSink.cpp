@@ -0,0 +1,133 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/utilities/OutputSink.h>
+
+const std::string nddlgen::utilities::OutputSink::INDENTS(16, '\t');
+const std::string nddlgen::utilities::OutputSink::LINE_BREAKS(16, '\n');
+const std::size_t nddlgen::utilities::OutputSink::DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+nddlgen::utilities::OutputSink::OutputSink(std::size_t blockSize)
+{
+	this->_blockSize = (blockSize < 1) ? 1 : blockSize;
+	this->_isClosed = false;
+
+	// Sinks with huge blocks grow their buffer as needed
+	this->_buffer.reserve(std::min(this->_blockSize, OutputSink::DEFAULT_BLOCK_SIZE));
+}
+
+nddlgen::utilities::OutputSink::~OutputSink()
+{
+
+}
+
+void nddlgen::utilities::OutputSink::write(const std::string& text)
+{
+	this->write(text.data(), text.size());
+}
+
+void nddlgen::utilities::OutputSink::write(const char* text, std::size_t size)
+{
+	// The buffer holds less than a block, fill it up to a full block at a time
+	while (size > 0)
+	{
+		std::size_t count = std::min(size, this->_blockSize - this->_buffer.size());
+
+		this->_buffer.append(text, count);
+		this->writeFullBlocks();
+
+		text += count;
+		size -= count;
+	}
+}
+
+void nddlgen::utilities::OutputSink::writeLine(int indents, const std::string& line, int endls)
+{
+	this->writeRepeated(OutputSink::INDENTS, indents);
+	this->_buffer.append(line);
+	this->writeRepeated(OutputSink::LINE_BREAKS, endls);
+	this->writeFullBlocks();
+}
+
+void nddlgen::utilities::OutputSink::writeEmptyLines(int endls)
+{
+	this->writeRepeated(OutputSink::LINE_BREAKS, endls);
+	this->writeFullBlocks();
+}
+
+void nddlgen::utilities::OutputSink::close()
+{
+	if (this->_isClosed)
+	{
+		return;
+	}
+
+	this->_isClosed = true;
+
+	if (!this->_buffer.empty())
+	{
+		this->writeLastBlock(this->_buffer);
+		this->_buffer.clear();
+	}
+
+	this->finish();
+}
+
+bool nddlgen::utilities::OutputSink::isClosed()
+{
+	return this->_isClosed;
+}
+
+void nddlgen::utilities::OutputSink::writeLastBlock(std::string& buffer)
+{
+	this->writeBlock(buffer.data(), buffer.size());
+}
+
+void nddlgen::utilities::OutputSink::finish()
+{
+	// Dummy. Do nothing
+}
+
+void nddlgen::utilities::OutputSink::writeFullBlocks()
+{
+	if (this->_buffer.size() < this->_blockSize)
+	{
+		return;
+	}
+
+	// Write one block per call, and keep the rest of the last block, which is usually small
+	std::size_t offset = 0;
+
+	for (; this->_buffer.size() - offset >= this->_blockSize; offset += this->_blockSize)
+	{
+		this->writeBlock(this->_buffer.data() + offset, this->_blockSize);
+	}
+
+	this->_buffer.erase(0, offset);
+}
+
+void nddlgen::utilities::OutputSink::writeRepeated(const std::string& source, int count)
+{
+	for (; count > (int) source.size(); count -= source.size())
+	{
+		this->_buffer.append(source);
+	}
+
+	if (count > 0)
+	{
+		this->_buffer.append(source, 0, count);
+	}
+}
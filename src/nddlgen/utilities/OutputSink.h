@@ -0,0 +1,175 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_UTILITIES_OUTPUTSINK_H_
+#define NDDLGEN_UTILITIES_OUTPUTSINK_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+
+namespace nddlgen
+{
+	namespace utilities
+	{
+		class OutputSink;
+		typedef boost::shared_ptr<nddlgen::utilities::OutputSink> OutputSinkPtr;
+	}
+}
+
+/**
+ * Abstract target for generated NDDL. Text is collected in large blocks, which are only
+ * handed to the implementation once they are full and when the sink is closed. Implementations
+ * decide where the blocks go, e.g. FileOutputSink, MemoryOutputSink or CallbackOutputSink.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::utilities::OutputSink
+{
+
+	private:
+
+		/**
+		 * Tabs and line breaks to copy indentation and line endings from.
+		 */
+		static const std::string INDENTS;
+		static const std::string LINE_BREAKS;
+
+		/**
+		 * Size of the blocks handed to writeBlock() in bytes.
+		 */
+		std::size_t _blockSize;
+
+		/**
+		 * Text not handed to writeBlock() yet.
+		 */
+		std::string _buffer;
+
+		/**
+		 * Flag to keep track if the sink was closed.
+		 */
+		bool _isClosed;
+
+		/**
+		 * Hands all full blocks of the buffer to writeBlock(), one block per call.
+		 */
+		void writeFullBlocks();
+
+		/**
+		 * Appends a character repeatedly to the buffer.
+		 *
+		 * @param source Text consisting of the character only
+		 * @param count Amount of repetitions
+		 */
+		void writeRepeated(const std::string& source, int count);
+
+		/**
+		 * Output sinks can not be copied.
+		 */
+		OutputSink(const OutputSink& other);
+		OutputSink& operator=(const OutputSink& other);
+
+	protected:
+
+		/**
+		 * Default size of blocks in bytes.
+		 */
+		static const std::size_t DEFAULT_BLOCK_SIZE;
+
+		/**
+		 * Constructs a new output sink.
+		 *
+		 * @param blockSize Size of the blocks handed to writeBlock() in bytes
+		 */
+		OutputSink(std::size_t blockSize);
+
+		/**
+		 * Writes a block of text to the target. All blocks but the last one have the block size.
+		 *
+		 * @param data First character
+		 * @param size Amount of characters
+		 */
+		virtual void writeBlock(const char* data, std::size_t size) = 0;
+
+		/**
+		 * Writes the text left in the buffer when the sink is closed. Passes it to
+		 * writeBlock() by default. Sinks keeping all text in memory may take the buffer over
+		 * instead of copying it.
+		 *
+		 * @param buffer Remaining text, which may be modified
+		 */
+		virtual void writeLastBlock(std::string& buffer);
+
+		/**
+		 * Called once after the last block was written. Does nothing by default.
+		 */
+		virtual void finish();
+
+	public:
+
+		/**
+		 * Destructor to free memory. Text not written by close() is lost.
+		 */
+		virtual ~OutputSink();
+
+		/**
+		 * Writes text.
+		 *
+		 * @param text Text
+		 */
+		void write(const std::string& text);
+
+		/**
+		 * Writes text. Long text is buffered a block at a time, so it is not copied as a whole.
+		 *
+		 * @param text First character
+		 * @param size Amount of characters
+		 */
+		void write(const char* text, std::size_t size);
+
+		/**
+		 * Writes an indented line.
+		 *
+		 * @param indents Amount of tabs to indent the line with
+		 * @param line Line without line break
+		 * @param endls Amount of line breaks after the line
+		 */
+		void writeLine(int indents, const std::string& line, int endls);
+
+		/**
+		 * Writes empty lines.
+		 *
+		 * @param endls Amount of line breaks
+		 */
+		void writeEmptyLines(int endls);
+
+		/**
+		 * Writes all buffered text to the target and finishes it. Further calls do nothing.
+		 */
+		void close();
+
+		/**
+		 * Tests if the sink was closed.
+		 *
+		 * @return True, if close() was called, false if not.
+		 */
+		bool isClosed();
+
+};
+
+#endif
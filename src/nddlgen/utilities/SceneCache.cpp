@@ -0,0 +1,419 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/utilities/SceneCache.h>
+
+const boost::uint32_t nddlgen::utilities::SceneCache::FORMAT_VERSION = 2;
+const boost::uintmax_t nddlgen::utilities::SceneCache::DEFAULT_SIZE_LIMIT = 256 * 1024 * 1024;
+
+namespace
+{
+	const char MAGIC[8] = { 'N', 'D', 'D', 'L', 'S', 'C', 'N', '\0' };
+	const boost::uint32_t BYTE_ORDER_MARK = 0x01020304;
+}
+
+nddlgen::utilities::SceneCache::SceneCache(const std::string& directory, boost::uintmax_t sizeLimit)
+{
+	this->_directory = directory;
+	this->_sizeLimit = sizeLimit;
+}
+
+nddlgen::utilities::SceneCache::~SceneCache()
+{
+
+}
+
+nddlgen::utilities::SceneRecordPtr nddlgen::utilities::SceneCache::load(const Key& key)
+{
+	nddlgen::utilities::SceneRecordPtr scene;
+	boost::filesystem::path file = this->getFile(key);
+	boost::system::error_code error;
+
+	if (!boost::filesystem::exists(file, error))
+	{
+		return scene;
+	}
+
+	try
+	{
+		nddlgen::utilities::MappedFilePtr mapping(new nddlgen::utilities::MappedFile(file.string()));
+
+		const char* position = mapping->getData();
+		const char* end = position + mapping->getSize();
+
+		// Header fields are only compared or used if all of them were read, the initial values
+		// merely keep a truncated header well-defined
+		char magic[8] = { 0 };
+		boost::uint32_t version = 0;
+		boost::uint32_t byteOrderMark = 0;
+		Key storedKey = { 0, 0, 0, 0 };
+		boost::uint64_t modelCount = 0;
+		boost::uint64_t goalCount = 0;
+
+		bool valid = SceneCache::readValue(position, end, magic, sizeof(magic))
+				&& SceneCache::readValue(position, end, &version, sizeof(version))
+				&& SceneCache::readValue(position, end, &byteOrderMark, sizeof(byteOrderMark))
+				&& SceneCache::readNumber(position, end, storedKey.value)
+				&& SceneCache::readNumber(position, end, storedKey.checksum)
+				&& SceneCache::readNumber(position, end, storedKey.sdfInputSize)
+				&& SceneCache::readNumber(position, end, storedKey.isdInputSize)
+				&& SceneCache::readNumber(position, end, modelCount)
+				&& SceneCache::readNumber(position, end, goalCount)
+				&& std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0
+				&& version == SceneCache::FORMAT_VERSION
+				&& byteOrderMark == BYTE_ORDER_MARK
+				&& storedKey.value == key.value
+				&& storedKey.checksum == key.checksum
+				&& storedKey.sdfInputSize == key.sdfInputSize
+				&& storedKey.isdInputSize == key.isdInputSize;
+
+		nddlgen::utilities::SceneRecordPtr record(new nddlgen::utilities::SceneRecord());
+		record->keepBuffer(mapping);
+
+		for (boost::uint64_t i = 0; valid && i < modelCount; i++)
+		{
+			std::string name;
+			boost::uint64_t linkCount = 0;
+
+			valid = SceneCache::readString(position, end, name);
+
+			if (!valid)
+			{
+				break;
+			}
+
+			SceneRecord::Model& model = record->addModel(name);
+
+			valid = SceneCache::readString(position, end, model.pose)
+					&& SceneCache::readNumber(position, end, linkCount);
+
+			for (boost::uint64_t j = 0; valid && j < linkCount; j++)
+			{
+				valid = SceneCache::readString(position, end, name);
+
+				if (!valid)
+				{
+					break;
+				}
+
+				SceneRecord::Link& link = SceneRecord::addLink(model, name);
+
+				valid = SceneCache::readString(position, end, link.visualPose)
+						&& SceneCache::readString(position, end, link.boxSize)
+						&& SceneCache::readCuboid(position, end, link.boundingBox);
+			}
+		}
+
+		for (boost::uint64_t i = 0; valid && i < goalCount; i++)
+		{
+			SceneRecord::Goal& goal = record->addGoal();
+
+			valid = SceneCache::readView(position, end, goal.name)
+					&& SceneCache::readView(position, end, goal.objectName)
+					&& SceneCache::readView(position, end, goal.predicate)
+					&& SceneCache::readView(position, end, goal.startsAfter)
+					&& SceneCache::readView(position, end, goal.endsBefore);
+		}
+
+		if (valid && position == end)
+		{
+			scene = record;
+		}
+	}
+	catch (const nddlgen::exceptions::MappingFileException&)
+	{
+		// Unreadable files are treated like missing ones
+	}
+
+	if (scene)
+	{
+		// Mark the file as recently used, so it is evicted last
+		boost::filesystem::last_write_time(file, std::time(0), error);
+	}
+	else
+	{
+		boost::filesystem::remove(file, error);
+	}
+
+	return scene;
+}
+
+bool nddlgen::utilities::SceneCache::store(const Key& key, nddlgen::utilities::SceneRecordPtr scene)
+{
+	std::string buffer;
+
+	// Header
+	SceneCache::writeValue(buffer, MAGIC, sizeof(MAGIC));
+	SceneCache::writeValue(buffer, &SceneCache::FORMAT_VERSION, sizeof(SceneCache::FORMAT_VERSION));
+	SceneCache::writeValue(buffer, &BYTE_ORDER_MARK, sizeof(BYTE_ORDER_MARK));
+	SceneCache::writeNumber(buffer, key.value);
+	SceneCache::writeNumber(buffer, key.checksum);
+	SceneCache::writeNumber(buffer, key.sdfInputSize);
+	SceneCache::writeNumber(buffer, key.isdInputSize);
+	SceneCache::writeNumber(buffer, scene->getModels().size());
+	SceneCache::writeNumber(buffer, scene->getGoals().size());
+
+	// Models and their links
+	foreach (const SceneRecord::Model& model, scene->getModels())
+	{
+		SceneCache::writeString(buffer, model.name);
+		SceneCache::writeString(buffer, model.pose);
+		SceneCache::writeNumber(buffer, model.links.size());
+
+		foreach (const SceneRecord::Link& link, model.links)
+		{
+			SceneCache::writeString(buffer, link.name);
+			SceneCache::writeString(buffer, link.visualPose);
+			SceneCache::writeString(buffer, link.boxSize);
+			SceneCache::writeCuboid(buffer, link.boundingBox);
+		}
+	}
+
+	// Goals
+	foreach (const SceneRecord::Goal& goal, scene->getGoals())
+	{
+		SceneCache::writeString(buffer, goal.name);
+		SceneCache::writeString(buffer, goal.objectName);
+		SceneCache::writeString(buffer, goal.predicate);
+		SceneCache::writeString(buffer, goal.startsAfter);
+		SceneCache::writeString(buffer, goal.endsBefore);
+	}
+
+	boost::system::error_code error;
+	boost::filesystem::create_directories(this->_directory, error);
+
+	// Write under a temporary name within the same directory, so renaming is atomic
+	boost::filesystem::path file = this->getFile(key);
+	boost::filesystem::path temporaryFile = this->_directory
+			/ boost::filesystem::unique_path(file.filename().string() + ".%%%%-%%%%-%%%%.tmp", error);
+
+	if (error)
+	{
+		return false;
+	}
+
+	std::FILE* stream = std::fopen(temporaryFile.string().c_str(), "wb");
+
+	if (!stream)
+	{
+		return false;
+	}
+
+	bool written = std::fwrite(buffer.data(), 1, buffer.size(), stream) == buffer.size();
+	written = (std::fclose(stream) == 0) && written;
+
+	if (written)
+	{
+		boost::filesystem::rename(temporaryFile, file, error);
+		written = !error;
+	}
+
+	if (!written)
+	{
+		boost::filesystem::remove(temporaryFile, error);
+		return false;
+	}
+
+	this->evict();
+
+	return true;
+}
+
+boost::filesystem::path nddlgen::utilities::SceneCache::getFile(const Key& key)
+{
+	static const char digits[] = "0123456789abcdef";
+	std::string name(16, '0');
+
+	for (int i = 0; i < 16; i++)
+	{
+		name[15 - i] = digits[(key.value >> (4 * i)) & 0xf];
+	}
+
+	return this->_directory / (name + ".scene");
+}
+
+void nddlgen::utilities::SceneCache::evict()
+{
+	boost::system::error_code error;
+	boost::filesystem::directory_iterator entry(this->_directory, error);
+
+	if (error)
+	{
+		return;
+	}
+
+	// Last write time and path of all cache files
+	std::vector<std::pair<std::time_t, boost::filesystem::path> > files;
+	boost::uintmax_t totalSize = 0;
+
+	for (; entry != boost::filesystem::directory_iterator(); entry.increment(error))
+	{
+		if (error)
+		{
+			return;
+		}
+
+		const boost::filesystem::path& file = entry->path();
+
+		if (file.extension() != ".scene")
+		{
+			continue;
+		}
+
+		boost::uintmax_t size = boost::filesystem::file_size(file, error);
+		std::time_t lastWriteTime = boost::filesystem::last_write_time(file, error);
+
+		if (!error)
+		{
+			files.push_back(std::make_pair(lastWriteTime, file));
+			totalSize += size;
+		}
+	}
+
+	// Remove least recently used files first
+	std::sort(files.begin(), files.end());
+
+	for (std::size_t i = 0; i < files.size() && totalSize > this->_sizeLimit; i++)
+	{
+		boost::uintmax_t size = boost::filesystem::file_size(files[i].second, error);
+
+		if (!error && boost::filesystem::remove(files[i].second, error))
+		{
+			totalSize -= size;
+		}
+	}
+}
+
+void nddlgen::utilities::SceneCache::writeValue(std::string& buffer, const void* value, std::size_t size)
+{
+	buffer.append(static_cast<const char*>(value), size);
+	buffer.append((8 - buffer.size() % 8) % 8, '\0');
+}
+
+void nddlgen::utilities::SceneCache::writeNumber(std::string& buffer, boost::uint64_t value)
+{
+	SceneCache::writeValue(buffer, &value, sizeof(value));
+}
+
+void nddlgen::utilities::SceneCache::writeString(std::string& buffer, boost::string_ref value)
+{
+	SceneCache::writeNumber(buffer, value.size());
+	SceneCache::writeValue(buffer, value.data(), value.size());
+}
+
+void nddlgen::utilities::SceneCache::writeCuboid(std::string& buffer, nddlgen::math::CuboidPtr cuboid)
+{
+	SceneCache::writeNumber(buffer, cuboid ? 1 : 0);
+
+	if (cuboid)
+	{
+		nddlgen::math::Vector3 values[5] = {
+				cuboid->getCenter(),
+				cuboid->getHalfExtents(),
+				cuboid->getAxis(0),
+				cuboid->getAxis(1),
+				cuboid->getAxis(2)
+		};
+
+		SceneCache::writeValue(buffer, values, sizeof(values));
+	}
+}
+
+bool nddlgen::utilities::SceneCache::readValue(const char*& position, const char* end, void* value,
+		std::size_t size)
+{
+	std::size_t paddedSize = (size + 7) / 8 * 8;
+
+	if ((std::size_t) (end - position) < paddedSize)
+	{
+		return false;
+	}
+
+	std::memcpy(value, position, size);
+	position += paddedSize;
+
+	return true;
+}
+
+bool nddlgen::utilities::SceneCache::readNumber(const char*& position, const char* end,
+		boost::uint64_t& value)
+{
+	return SceneCache::readValue(position, end, &value, sizeof(value));
+}
+
+bool nddlgen::utilities::SceneCache::readString(const char*& position, const char* end,
+		std::string& value)
+{
+	boost::string_ref view;
+
+	if (!SceneCache::readView(position, end, view))
+	{
+		return false;
+	}
+
+	value.assign(view.data(), view.size());
+
+	return true;
+}
+
+bool nddlgen::utilities::SceneCache::readView(const char*& position, const char* end,
+		boost::string_ref& value)
+{
+	boost::uint64_t size;
+
+	if (!SceneCache::readNumber(position, end, size) || size > (boost::uint64_t) (end - position))
+	{
+		return false;
+	}
+
+	std::size_t paddedSize = (size + 7) / 8 * 8;
+
+	if ((std::size_t) (end - position) < paddedSize)
+	{
+		return false;
+	}
+
+	value = boost::string_ref(position, size);
+	position += paddedSize;
+
+	return true;
+}
+
+bool nddlgen::utilities::SceneCache::readCuboid(const char*& position, const char* end,
+		nddlgen::math::CuboidPtr& cuboid)
+{
+	boost::uint64_t isBuilt;
+
+	if (!SceneCache::readNumber(position, end, isBuilt))
+	{
+		return false;
+	}
+
+	if (isBuilt)
+	{
+		nddlgen::math::Vector3 values[5];
+
+		if (!SceneCache::readValue(position, end, values, sizeof(values)))
+		{
+			return false;
+		}
+
+		nddlgen::math::Vector3 axes[3] = { values[2], values[3], values[4] };
+		cuboid.reset(new nddlgen::math::Cuboid(values[0], values[1], axes));
+	}
+
+	return true;
+}
@@ -0,0 +1,183 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_UTILITIES_SCENECACHE_H_
+#define NDDLGEN_UTILITIES_SCENECACHE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/utility/string_ref.hpp>
+
+#include <nddlgen/math/Cuboid.h>
+#include <nddlgen/math/Vector3.hpp>
+#include <nddlgen/utilities/MappedFile.h>
+#include <nddlgen/utilities/SceneRecord.h>
+#include <nddlgen/utilities/Foreach.hpp>
+
+namespace nddlgen
+{
+	namespace utilities
+	{
+		class SceneCache;
+		typedef boost::shared_ptr<nddlgen::utilities::SceneCache> SceneCachePtr;
+	}
+}
+
+/**
+ * On-disk cache of scene records, keyed by hashes of the input files they were built from.
+ * Each record is stored in its own file in a compact binary format, which is read back
+ * through a memory mapping:
+ *
+ * - Header: Magic "NDDLSCN", format version and byte order mark (32 bit each), hash value,
+ *   checksum, size of the SDF and the ISD input file, amount of models and amount of goals
+ *   (64 bit each)
+ * - Per model: Name, pose and amount of links, followed by each link with name, visual pose,
+ *   box size, a flag whether a bounding box was built and the bounding box (center, half
+ *   extents and the three axes as 15 doubles)
+ * - Per goal: Name, object name, predicate, starts after and ends before
+ *
+ * The file name is derived from the hash value. A file is only loaded if all fields of the key
+ * match, so a collision of hash values does not return the scene of different input files.
+ * Strings are stored as their 64 bit length followed by the characters. Goals of a loaded
+ * record point into the mapping instead of copying them. All fields start at
+ * multiples of 8 bytes. Numbers are stored in the byte order of the machine, so files of a
+ * different machine are treated like missing ones. Invalid files are treated like missing
+ * ones as well, so the cache never makes a workflow fail. If the files of the cache exceed
+ * the size limit, the least recently used ones are removed.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::utilities::SceneCache
+{
+
+	public:
+
+		/**
+		 * Key of a scene record, identifying the input files it was built from.
+		 */
+		struct Key
+		{
+			boost::uint64_t value;
+			boost::uint64_t checksum;
+			boost::uint64_t sdfInputSize;
+			boost::uint64_t isdInputSize;
+		};
+
+	private:
+
+		/**
+		 * Version of the file format. Files of other versions are ignored.
+		 */
+		static const boost::uint32_t FORMAT_VERSION;
+
+		/**
+		 * Directory holding the cache files.
+		 */
+		boost::filesystem::path _directory;
+
+		/**
+		 * Maximum total size of all cache files in bytes.
+		 */
+		boost::uintmax_t _sizeLimit;
+
+		/**
+		 * Gets the path of the cache file of a key.
+		 *
+		 * @param key Key
+		 *
+		 * @return Path of the cache file.
+		 */
+		boost::filesystem::path getFile(const Key& key);
+
+		/**
+		 * Removes the least recently used cache files until all files fit into the size limit.
+		 */
+		void evict();
+
+		/**
+		 * Helpers to serialize a scene record. Every value is padded to a multiple of 8 bytes.
+		 */
+		static void writeValue(std::string& buffer, const void* value, std::size_t size);
+		static void writeNumber(std::string& buffer, boost::uint64_t value);
+		static void writeString(std::string& buffer, boost::string_ref value);
+		static void writeCuboid(std::string& buffer, nddlgen::math::CuboidPtr cuboid);
+
+		/**
+		 * Helpers to deserialize a scene record. Each reads a value at position and advances
+		 * position past it.
+		 *
+		 * @return False, if the value does not fit before end.
+		 */
+		static bool readValue(const char*& position, const char* end, void* value, std::size_t size);
+		static bool readNumber(const char*& position, const char* end, boost::uint64_t& value);
+		static bool readString(const char*& position, const char* end, std::string& value);
+		static bool readView(const char*& position, const char* end, boost::string_ref& value);
+		static bool readCuboid(const char*& position, const char* end, nddlgen::math::CuboidPtr& cuboid);
+
+	public:
+
+		/**
+		 * Default maximum total size of all cache files in bytes.
+		 */
+		static const boost::uintmax_t DEFAULT_SIZE_LIMIT;
+
+		/**
+		 * Constructs a new cache. The directory is created when the first record is stored.
+		 *
+		 * @param directory Directory holding the cache files
+		 * @param sizeLimit Maximum total size of all cache files in bytes
+		 */
+		SceneCache(const std::string& directory, boost::uintmax_t sizeLimit);
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~SceneCache();
+
+		/**
+		 * Loads the scene record stored for a key.
+		 *
+		 * @param key Key
+		 *
+		 * @return Scene record, or null if none is stored or the file is invalid.
+		 */
+		nddlgen::utilities::SceneRecordPtr load(const Key& key);
+
+		/**
+		 * Stores a scene record for a key, replacing a record that was stored for it before.
+		 * The file is written under a temporary name and renamed afterwards, so concurrent
+		 * workflows never see partially written records.
+		 *
+		 * @param key Key
+		 * @param scene Scene record
+		 *
+		 * @return True, if the record was stored, false if writing failed.
+		 */
+		bool store(const Key& key, nddlgen::utilities::SceneRecordPtr scene);
+
+};
+
+#endif
@@ -0,0 +1,156 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/utilities/SceneRecord.h>
+
+const std::string nddlgen::utilities::SceneRecord::DEFAULT_POSE = "0 0 0 0 0 0";
+const std::string nddlgen::utilities::SceneRecord::DEFAULT_SIZE = "1 1 1";
+
+nddlgen::utilities::SceneRecord::SceneRecord()
+{
+
+}
+
+nddlgen::utilities::SceneRecord::~SceneRecord()
+{
+
+}
+
+nddlgen::utilities::SceneRecordPtr nddlgen::utilities::SceneRecord::fromSdf(nddlgen::types::SdfRoot sdfRoot)
+{
+	nddlgen::utilities::SceneRecordPtr scene(new nddlgen::utilities::SceneRecord());
+	sdf::ElementPtr modelElement = sdfRoot->root->GetElement("world")->GetElement("model");
+
+	// Iterate through elements in SDF model node. GetElement() adds missing elements with
+	// their default values, so every value read below is defined
+	while (modelElement)
+	{
+		Model& model = scene->addModel(modelElement->GetAttribute("name")->GetAsString());
+		model.pose = modelElement->GetElement("pose")->GetValue()->GetAsString();
+
+		sdf::ElementPtr linkElement = modelElement->GetElement("link");
+
+		while (linkElement)
+		{
+			sdf::ElementPtr visualElement = linkElement->GetElement("visual");
+
+			Link& link = SceneRecord::addLink(model, linkElement->GetAttribute("name")->GetAsString());
+			link.visualPose = visualElement->GetElement("pose")->GetValue()->GetAsString();
+			link.boxSize = visualElement->GetElement("geometry")->GetElement("box")
+					->GetElement("size")->GetValue()->GetAsString();
+
+			// Iterate
+			linkElement = linkElement->GetNextElement("link");
+		}
+
+		// Iterate
+		modelElement = modelElement->GetNextElement("model");
+	}
+
+	return scene;
+}
+
+nddlgen::utilities::SceneRecord::Model& nddlgen::utilities::SceneRecord::addModel(const std::string& name)
+{
+	this->_models.push_back(Model());
+
+	Model& model = this->_models.back();
+	model.name = name;
+	model.pose = SceneRecord::DEFAULT_POSE;
+
+	return model;
+}
+
+nddlgen::utilities::SceneRecord::Link& nddlgen::utilities::SceneRecord::addLink(Model& model,
+		const std::string& name)
+{
+	model.links.push_back(Link());
+
+	Link& link = model.links.back();
+	link.name = name;
+	link.visualPose = SceneRecord::DEFAULT_POSE;
+	link.boxSize = SceneRecord::DEFAULT_SIZE;
+
+	return link;
+}
+
+void nddlgen::utilities::SceneRecord::addGoalsFromIsd(nddlgen::types::IsdRoot isdRoot)
+{
+	// Goals point into the attributes of the document
+	this->keepBuffer(isdRoot);
+
+	TiXmlHandle isdRootHandle(isdRoot->RootElement());
+	TiXmlElement* goalElement = isdRootHandle.FirstChild("goals").FirstChild("goal").ToElement();
+
+	// Iterate through goals of the ISD
+	for (; goalElement; goalElement = goalElement->NextSiblingElement())
+	{
+		Goal& goal = this->addGoal();
+
+		goal.name = SceneRecord::getAttribute(goalElement, "name", false);
+		goal.objectName = SceneRecord::getAttribute(goalElement, "for", true);
+		goal.predicate = SceneRecord::getAttribute(goalElement, "predicate", true);
+		goal.startsAfter = SceneRecord::getAttribute(goalElement, "starts-after", false);
+		goal.endsBefore = SceneRecord::getAttribute(goalElement, "ends-before", false);
+	}
+}
+
+nddlgen::utilities::SceneRecord::Goal& nddlgen::utilities::SceneRecord::addGoal()
+{
+	this->_goals.push_back(Goal());
+
+	return this->_goals.back();
+}
+
+void nddlgen::utilities::SceneRecord::keepBuffer(boost::shared_ptr<const void> buffer)
+{
+	this->_buffers.push_back(buffer);
+}
+
+const std::vector<nddlgen::utilities::SceneRecord::Model>& nddlgen::utilities::SceneRecord::getModels() const
+{
+	return this->_models;
+}
+
+std::vector<nddlgen::utilities::SceneRecord::Model>& nddlgen::utilities::SceneRecord::getModels()
+{
+	return this->_models;
+}
+
+const std::vector<nddlgen::utilities::SceneRecord::Goal>& nddlgen::utilities::SceneRecord::getGoals() const
+{
+	return this->_goals;
+}
+
+boost::string_ref nddlgen::utilities::SceneRecord::getAttribute(const TiXmlElement* element, const char* name,
+		bool isRequired)
+{
+	const char* value = element->Attribute(name);
+
+	if (value)
+	{
+		return boost::string_ref(value);
+	}
+
+	if (isRequired)
+	{
+		throw nddlgen::exceptions::MalformedIsdException("Goal in line "
+				+ boost::lexical_cast<std::string>(element->Row())
+				+ " lacks the attribute \"" + name + "\".");
+	}
+
+	return boost::string_ref();
+}
@@ -0,0 +1,218 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_UTILITIES_SCENERECORD_H_
+#define NDDLGEN_UTILITIES_SCENERECORD_H_
+
+#include <string>
+#include <vector>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/utility/string_ref.hpp>
+#include <sdf/sdf.hh>
+#include <tinyxml.h>
+
+#include <nddlgen/exceptions/MalformedIsdException.hpp>
+#include <nddlgen/math/Cuboid.h>
+#include <nddlgen/utilities/Types.hpp>
+
+namespace nddlgen
+{
+	namespace utilities
+	{
+		class SceneRecord;
+		typedef boost::shared_ptr<nddlgen::utilities::SceneRecord> SceneRecordPtr;
+	}
+}
+
+/**
+ * Compact record of the parts of an SDF world the domain description is built from: The
+ * models of the world with their name and pose, and the links of each model with their name,
+ * the pose of their visual and the size of its box geometry. Poses and sizes are kept as
+ * they appear in the SDF and are parsed when the bounding boxes are built. The bounding box
+ * built from a link is kept in the record as well. Goals of an ISD can be added to the record,
+ * so it holds everything the domain description is built from. The fields of goals are views
+ * into the buffer they were read from, which is kept alive by the record.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::utilities::SceneRecord
+{
+
+	public:
+
+		/**
+		 * Default pose of an SDF element without a pose.
+		 */
+		static const std::string DEFAULT_POSE;
+
+		/**
+		 * Default size of an SDF box without a size.
+		 */
+		static const std::string DEFAULT_SIZE;
+
+		/**
+		 * Link of a model.
+		 */
+		struct Link
+		{
+			std::string name;
+			std::string visualPose;
+			std::string boxSize;
+
+			/**
+			 * Bounding box built from the poses and the size, or null if not built yet.
+			 */
+			nddlgen::math::CuboidPtr boundingBox;
+		};
+
+		/**
+		 * Model of the world.
+		 */
+		struct Model
+		{
+			std::string name;
+			std::string pose;
+			std::vector<Link> links;
+		};
+
+		/**
+		 * Goal of the ISD. Optional fields which are not set are empty.
+		 */
+		struct Goal
+		{
+			boost::string_ref name;
+			boost::string_ref objectName;
+			boost::string_ref predicate;
+			boost::string_ref startsAfter;
+			boost::string_ref endsBefore;
+		};
+
+	private:
+
+		/**
+		 * All models of the world, in document order.
+		 */
+		std::vector<Model> _models;
+
+		/**
+		 * All goals, in document order.
+		 */
+		std::vector<Goal> _goals;
+
+		/**
+		 * Buffers the fields of goals point into.
+		 */
+		std::vector<boost::shared_ptr<const void> > _buffers;
+
+		/**
+		 * Gets an attribute of an ISD element as a view into the document.
+		 *
+		 * @param element Element
+		 * @param name Name of the attribute
+		 * @param isRequired True, if a missing attribute is an error
+		 *
+		 * @return Value of the attribute, or an empty view if it is optional and missing.
+		 *
+		 * @throws MalformedIsdException if the attribute is required and missing.
+		 */
+		static boost::string_ref getAttribute(const TiXmlElement* element, const char* name, bool isRequired);
+
+	public:
+
+		/**
+		 * Constructs a new, empty scene record.
+		 */
+		SceneRecord();
+
+		/**
+		 * Destructor to free memory.
+		 */
+		virtual ~SceneRecord();
+
+		/**
+		 * Builds a scene record from a document parsed by the SDF library. Missing elements
+		 * get the defaults of the SDF library.
+		 *
+		 * @param sdfRoot SDF document root
+		 *
+		 * @return Scene record of the first world of the document.
+		 */
+		static nddlgen::utilities::SceneRecordPtr fromSdf(nddlgen::types::SdfRoot sdfRoot);
+
+		/**
+		 * Appends a model with the default pose and without links.
+		 *
+		 * @param name Name of the model
+		 *
+		 * @return Reference to the new model, valid until the next model is added.
+		 */
+		Model& addModel(const std::string& name);
+
+		/**
+		 * Appends a link with default visual pose and box size to a model.
+		 *
+		 * @param model Model to add the link to
+		 * @param name Name of the link
+		 *
+		 * @return Reference to the new link, valid until the next link is added to model.
+		 */
+		static Link& addLink(Model& model, const std::string& name);
+
+		/**
+		 * Appends the goals of an ISD document. The fields of the goals point into the
+		 * document, which is kept alive by the record. Goals need the attributes "for"
+		 * and "predicate", whereas "name", "starts-after" and "ends-before" are optional.
+		 *
+		 * @param isdRoot ISD document root
+		 *
+		 * @throws MalformedIsdException if a goal lacks a required attribute.
+		 */
+		void addGoalsFromIsd(nddlgen::types::IsdRoot isdRoot);
+
+		/**
+		 * Appends an empty goal. Its fields must point into buffers kept alive by keepBuffer().
+		 *
+		 * @return Reference to the new goal, valid until the next goal is added.
+		 */
+		Goal& addGoal();
+
+		/**
+		 * Keeps a buffer alive as long as this record, so fields of goals can point into it.
+		 *
+		 * @param buffer Buffer
+		 */
+		void keepBuffer(boost::shared_ptr<const void> buffer);
+
+		/**
+		 * Gets all models of the world.
+		 *
+		 * @return Models, in document order.
+		 */
+		const std::vector<Model>& getModels() const;
+		std::vector<Model>& getModels();
+
+		/**
+		 * Gets all goals.
+		 *
+		 * @return Goals, in document order.
+		 */
+		const std::vector<Goal>& getGoals() const;
+
+};
+
+#endif
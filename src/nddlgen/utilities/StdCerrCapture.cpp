@@ -0,0 +1,118 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/utilities/StdCerrCapture.h>
+
+const std::size_t nddlgen::utilities::StdCerrCapture::DEFAULT_LIMIT = 64 * 1024;
+
+boost::once_flag nddlgen::utilities::StdCerrCapture::_installFlag = BOOST_ONCE_INIT;
+nddlgen::utilities::StdCerrCapture::DispatchingBuffer* nddlgen::utilities::StdCerrCapture::_dispatchingBuffer = 0;
+boost::thread_specific_ptr<nddlgen::utilities::StdCerrCapture>* nddlgen::utilities::StdCerrCapture::_current = 0;
+
+nddlgen::utilities::StdCerrCapture::StdCerrCapture()
+{
+	this->start(StdCerrCapture::DEFAULT_LIMIT);
+}
+
+nddlgen::utilities::StdCerrCapture::StdCerrCapture(std::size_t limit)
+{
+	this->start(limit);
+}
+
+nddlgen::utilities::StdCerrCapture::~StdCerrCapture()
+{
+	// The dispatching buffer stays installed, without a capture it only forwards
+	StdCerrCapture::_current->reset(this->_previous);
+}
+
+std::string nddlgen::utilities::StdCerrCapture::getOutput() const
+{
+	if (this->_dropped == 0)
+	{
+		return this->_output;
+	}
+
+	return this->_output + "\n[" + boost::lexical_cast<std::string>(this->_dropped) + " more characters dropped]";
+}
+
+void nddlgen::utilities::StdCerrCapture::start(std::size_t limit)
+{
+	this->_limit = limit;
+	this->_dropped = 0;
+
+	boost::call_once(StdCerrCapture::_installFlag, &StdCerrCapture::install);
+
+	// Become the innermost capture of this thread
+	this->_previous = StdCerrCapture::_current->get();
+	StdCerrCapture::_current->reset(this);
+}
+
+void nddlgen::utilities::StdCerrCapture::install()
+{
+	StdCerrCapture::_current = new boost::thread_specific_ptr<StdCerrCapture>(&StdCerrCapture::keep);
+	StdCerrCapture::_dispatchingBuffer = new DispatchingBuffer(std::cerr.rdbuf());
+
+	std::cerr.rdbuf(StdCerrCapture::_dispatchingBuffer);
+}
+
+void nddlgen::utilities::StdCerrCapture::append(const char* characters, std::size_t count)
+{
+	std::size_t kept = std::min(count, this->_limit - this->_output.size());
+
+	this->_output.append(characters, kept);
+	this->_dropped += count - kept;
+}
+
+void nddlgen::utilities::StdCerrCapture::keep(StdCerrCapture*)
+{
+
+}
+
+nddlgen::utilities::StdCerrCapture::DispatchingBuffer::DispatchingBuffer(std::streambuf* target)
+{
+	this->_target = target;
+}
+
+int nddlgen::utilities::StdCerrCapture::DispatchingBuffer::overflow(int character)
+{
+	if (character == traits_type::eof())
+	{
+		return traits_type::not_eof(character);
+	}
+
+	char output = traits_type::to_char_type(character);
+
+	return (this->xsputn(&output, 1) == 1) ? character : traits_type::eof();
+}
+
+std::streamsize nddlgen::utilities::StdCerrCapture::DispatchingBuffer::xsputn(const char* characters,
+		std::streamsize count)
+{
+	StdCerrCapture* capture = StdCerrCapture::_current->get();
+
+	if (capture)
+	{
+		capture->append(characters, count);
+		return count;
+	}
+
+	return this->_target ? this->_target->sputn(characters, count) : count;
+}
+
+int nddlgen::utilities::StdCerrCapture::DispatchingBuffer::sync()
+{
+	return (this->_target && !StdCerrCapture::_current->get()) ? this->_target->pubsync() : 0;
+}
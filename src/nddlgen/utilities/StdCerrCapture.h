@@ -0,0 +1,182 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_UTILITIES_STDCERRCAPTURE_H_
+#define NDDLGEN_UTILITIES_STDCERRCAPTURE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <streambuf>
+#include <string>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/thread/once.hpp>
+#include <boost/thread/tss.hpp>
+
+namespace nddlgen { namespace utilities { class StdCerrCapture; }}
+
+/**
+ * Captures everything the current thread writes to std::cerr while an instance exists, e.g.
+ * to collect the diagnostics of a library which can not be told otherwise where to write them.
+ * Output of other threads is not affected and still goes to std::cerr, so captures on
+ * different threads do not interfere. Captures on the same thread may be nested, the
+ * innermost one receives the output.
+ *
+ * To keep memory bounded, only the beginning of the output up to a limit is kept, and the
+ * amount of dropped characters is noted at its end.
+ *
+ * The first capture installs a dispatching stream buffer into std::cerr, which stays there
+ * for the lifetime of the process, so threads writing to std::cerr never race with swapping
+ * its buffer. Only installing it swaps the buffer, so the first capture should be created
+ * before other threads write to std::cerr. Redirecting std::cerr afterwards disables capturing.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::utilities::StdCerrCapture
+{
+
+	private:
+
+		/**
+		 * Stream buffer installed into std::cerr by the first capture. Forwards each write either
+		 * to the capture of the writing thread, or to the original buffer of std::cerr if there
+		 * is none.
+		 */
+		class DispatchingBuffer : public std::streambuf
+		{
+
+			private:
+
+				/**
+				 * Buffer std::cerr wrote to before this one was installed.
+				 */
+				std::streambuf* _target;
+
+			public:
+
+				DispatchingBuffer(std::streambuf* target);
+
+			protected:
+
+				virtual int overflow(int character);
+				virtual std::streamsize xsputn(const char* characters, std::streamsize count);
+				virtual int sync();
+
+		};
+
+		/**
+		 * Flag to install the dispatching buffer once.
+		 */
+		static boost::once_flag _installFlag;
+
+		/**
+		 * The dispatching buffer. Never deleted, since std::cerr may be written to during
+		 * static destruction.
+		 */
+		static DispatchingBuffer* _dispatchingBuffer;
+
+		/**
+		 * Innermost capture of each thread. Captures are owned by their creator, so the
+		 * pointer is never deleted. Created along with the dispatching buffer and never
+		 * deleted either, since the dispatching buffer uses it.
+		 */
+		static boost::thread_specific_ptr<StdCerrCapture>* _current;
+
+		/**
+		 * Capture that was innermost before this one, or null.
+		 */
+		StdCerrCapture* _previous;
+
+		/**
+		 * Captured output.
+		 */
+		std::string _output;
+
+		/**
+		 * Maximum amount of characters kept.
+		 */
+		std::size_t _limit;
+
+		/**
+		 * Amount of characters dropped after the limit was reached.
+		 */
+		std::size_t _dropped;
+
+		/**
+		 * Starts capturing.
+		 *
+		 * @param limit Maximum amount of characters kept
+		 */
+		void start(std::size_t limit);
+
+		/**
+		 * Installs the dispatching buffer into std::cerr. Only called once.
+		 */
+		static void install();
+
+		/**
+		 * Appends output, as far as the limit allows.
+		 */
+		void append(const char* characters, std::size_t count);
+
+		/**
+		 * Cleanup function for _current, which does nothing, since captures are owned by
+		 * their creator.
+		 */
+		static void keep(StdCerrCapture*);
+
+		/**
+		 * Captures can not be copied.
+		 */
+		StdCerrCapture(const StdCerrCapture& other);
+		StdCerrCapture& operator=(const StdCerrCapture& other);
+
+	public:
+
+		/**
+		 * Default maximum amount of characters kept.
+		 */
+		static const std::size_t DEFAULT_LIMIT;
+
+		/**
+		 * Starts capturing std::cerr of the current thread, keeping at most DEFAULT_LIMIT
+		 * characters.
+		 */
+		StdCerrCapture();
+
+		/**
+		 * Starts capturing std::cerr of the current thread.
+		 *
+		 * @param limit Maximum amount of characters kept
+		 */
+		StdCerrCapture(std::size_t limit);
+
+		/**
+		 * Destructor to stop capturing. Must be destroyed on the thread it was created on.
+		 */
+		virtual ~StdCerrCapture();
+
+		/**
+		 * Gets the output captured so far.
+		 *
+		 * @return Captured output, followed by a note if characters were dropped.
+		 */
+		std::string getOutput() const;
+
+};
+
+#endif
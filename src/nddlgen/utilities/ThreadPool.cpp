@@ -0,0 +1,259 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nddlgen/utilities/ThreadPool.h>
+
+boost::thread_specific_ptr<nddlgen::utilities::ThreadPool> nddlgen::utilities::ThreadPool::_current(
+		&nddlgen::utilities::ThreadPool::keep);
+
+nddlgen::utilities::ThreadPool::ThreadPool(int threadCount)
+{
+	this->_threadCount = (threadCount < 1) ? 1 : threadCount;
+	this->_generation = 0;
+	this->_busyWorkers = 0;
+	this->_stopping = false;
+	this->_failed = false;
+
+	for (int i = 0; i < this->_threadCount; i++)
+	{
+		boost::shared_ptr<Range> range(new Range());
+		range->next = 0;
+		range->end = 0;
+
+		this->_ranges.push_back(range);
+	}
+
+	// Range 0 belongs to the calling thread, so start threads for the other ones
+	for (int i = 1; i < this->_threadCount; i++)
+	{
+		this->_threads.create_thread(boost::bind(&ThreadPool::workerMain, this, i));
+	}
+}
+
+nddlgen::utilities::ThreadPool::~ThreadPool()
+{
+	{
+		boost::lock_guard<boost::mutex> lock(this->_mutex);
+		this->_stopping = true;
+	}
+
+	this->_loopStarted.notify_all();
+	this->_threads.join_all();
+}
+
+int nddlgen::utilities::ThreadPool::getThreadCount()
+{
+	return this->_threadCount;
+}
+
+void nddlgen::utilities::ThreadPool::parallelFor(int count, boost::function<void (int)> task)
+{
+	// Without additional threads, with a single iteration, or nested within another loop,
+	// simply run the loop
+	if (this->_threadCount == 1 || count <= 1 || ThreadPool::_current.get())
+	{
+		for (int i = 0; i < count; i++)
+		{
+			task(i);
+		}
+
+		return;
+	}
+
+	boost::lock_guard<boost::mutex> loopLock(this->_loopMutex);
+
+	// Split iterations into equally sized ranges
+	for (int i = 0; i < this->_threadCount; i++)
+	{
+		boost::lock_guard<boost::mutex> rangeLock(this->_ranges[i]->mutex);
+
+		this->_ranges[i]->next = (int) (((long long) count * i) / this->_threadCount);
+		this->_ranges[i]->end = (int) (((long long) count * (i + 1)) / this->_threadCount);
+	}
+
+	// Wake up worker threads
+	{
+		boost::lock_guard<boost::mutex> lock(this->_mutex);
+
+		this->_task = task;
+		this->_failed = false;
+		this->_exception = std::exception_ptr();
+		this->_busyWorkers = this->_threadCount - 1;
+		this->_generation++;
+	}
+
+	this->_loopStarted.notify_all();
+
+	// Take part in the work
+	this->work(0);
+
+	// Wait for the worker threads to finish
+	std::exception_ptr exception;
+
+	{
+		boost::unique_lock<boost::mutex> lock(this->_mutex);
+
+		while (this->_busyWorkers > 0)
+		{
+			this->_loopFinished.wait(lock);
+		}
+
+		this->_task = boost::function<void (int)>();
+		exception = this->_exception;
+	}
+
+	if (exception)
+	{
+		std::rethrow_exception(exception);
+	}
+}
+
+void nddlgen::utilities::ThreadPool::workerMain(int worker)
+{
+	int generation = 0;
+
+	while (true)
+	{
+		// Wait for the next loop
+		{
+			boost::unique_lock<boost::mutex> lock(this->_mutex);
+
+			while (!this->_stopping && this->_generation == generation)
+			{
+				this->_loopStarted.wait(lock);
+			}
+
+			if (this->_stopping)
+			{
+				return;
+			}
+
+			generation = this->_generation;
+		}
+
+		this->work(worker);
+
+		// Report that this thread is done
+		{
+			boost::lock_guard<boost::mutex> lock(this->_mutex);
+
+			this->_busyWorkers--;
+
+			if (this->_busyWorkers == 0)
+			{
+				this->_loopFinished.notify_all();
+			}
+		}
+	}
+}
+
+void nddlgen::utilities::ThreadPool::work(int worker)
+{
+	int begin;
+	int end;
+
+	ThreadPool::_current.reset(this);
+
+	while (this->nextChunk(worker, begin, end))
+	{
+		// Stop as soon as any iteration failed
+		for (int index = begin; index < end && !this->_failed; index++)
+		{
+			try
+			{
+				this->_task(index);
+			}
+			catch (...)
+			{
+				boost::lock_guard<boost::mutex> lock(this->_mutex);
+
+				// Only keep the first exception, and stop starting new iterations
+				if (!this->_failed)
+				{
+					this->_failed = true;
+					this->_exception = std::current_exception();
+				}
+			}
+		}
+	}
+
+	ThreadPool::_current.reset();
+}
+
+bool nddlgen::utilities::ThreadPool::nextChunk(int worker, int& begin, int& end)
+{
+	if (this->_failed)
+	{
+		return false;
+	}
+
+	Range& own = *this->_ranges[worker];
+
+	// Take the next chunk of the own range. Chunks are an eighth of the remaining iterations,
+	// so most of the range stays available for stealing
+	{
+		boost::lock_guard<boost::mutex> lock(own.mutex);
+
+		if (own.next < own.end)
+		{
+			begin = own.next;
+			end = begin + (own.end - own.next + 7) / 8;
+			own.next = end;
+
+			return true;
+		}
+	}
+
+	// Own range is empty, so steal the upper half of the next non-empty range of another thread
+	for (int i = 1; i < this->_threadCount; i++)
+	{
+		Range& victim = *this->_ranges[(worker + i) % this->_threadCount];
+		int stolenBegin;
+		int stolenEnd;
+
+		{
+			boost::lock_guard<boost::mutex> lock(victim.mutex);
+
+			int remaining = victim.end - victim.next;
+
+			if (remaining <= 0)
+			{
+				continue;
+			}
+
+			stolenBegin = victim.end - (remaining + 1) / 2;
+			stolenEnd = victim.end;
+			victim.end = stolenBegin;
+		}
+
+		// Run the first chunk of the stolen iterations right away and keep the rest
+		boost::lock_guard<boost::mutex> lock(own.mutex);
+
+		begin = stolenBegin;
+		end = begin + (stolenEnd - stolenBegin + 7) / 8;
+		own.next = end;
+		own.end = stolenEnd;
+
+		return true;
+	}
+
+	return false;
+}
+
+void nddlgen::utilities::ThreadPool::keep(ThreadPool*)
+{
+
+}
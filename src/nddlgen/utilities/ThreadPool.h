@@ -0,0 +1,207 @@
+/**
+ * Copyright 2015 Christian Dreher (dreher@charlydelta.org)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NDDLGEN_UTILITIES_THREADPOOL_H_
+#define NDDLGEN_UTILITIES_THREADPOOL_H_
+
+#include <exception>
+#include <vector>
+
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+
+namespace nddlgen
+{
+	namespace utilities
+	{
+		class ThreadPool;
+		typedef boost::shared_ptr<nddlgen::utilities::ThreadPool> ThreadPoolPtr;
+	}
+}
+
+/**
+ * Pool of worker threads to run the iterations of a loop in parallel. Every thread starts with
+ * an equally sized, contiguous range of iterations. Threads that finished their own range steal
+ * half of the remaining iterations of another thread, so uneven workloads are balanced.
+ *
+ * Threads take iterations from their range in chunks that shrink along with the range, so
+ * ranges are locked a few times per thread rather than once per iteration.
+ *
+ * The thread calling parallelFor() takes part in the work, so a pool with a thread count of n
+ * runs n - 1 additional threads. With a thread count of 1, no threads are started at all and
+ * the loop runs serially. Loops started from within an iteration run serially as well.
+ *
+ * @author Christian Dreher
+ */
+class nddlgen::utilities::ThreadPool
+{
+
+	private:
+
+		/**
+		 * Remaining iterations [next, end) of one thread.
+		 */
+		struct Range
+		{
+			boost::mutex mutex;
+			int next;
+			int end;
+		};
+
+		/**
+		 * Amount of threads, including the calling thread.
+		 */
+		int _threadCount;
+
+		/**
+		 * Additional worker threads.
+		 */
+		boost::thread_group _threads;
+
+		/**
+		 * Remaining iterations, one range per thread. The calling thread uses the first range.
+		 */
+		std::vector<boost::shared_ptr<Range> > _ranges;
+
+		/**
+		 * Body of the loop which is currently run.
+		 */
+		boost::function<void (int)> _task;
+
+		/**
+		 * Guards the state below.
+		 */
+		boost::mutex _mutex;
+
+		/**
+		 * Signals the worker threads that a new loop was started or that the pool stops.
+		 */
+		boost::condition_variable _loopStarted;
+
+		/**
+		 * Signals the calling thread that all worker threads finished the loop.
+		 */
+		boost::condition_variable _loopFinished;
+
+		/**
+		 * Incremented for each loop, so worker threads know whether they already ran it.
+		 */
+		int _generation;
+
+		/**
+		 * Amount of worker threads still running the current loop.
+		 */
+		int _busyWorkers;
+
+		/**
+		 * Set in the destructor to stop the worker threads.
+		 */
+		bool _stopping;
+
+		/**
+		 * Set if an iteration threw, so no further iterations are started. Atomic, since it is
+		 * checked before every iteration.
+		 */
+		boost::atomic<bool> _failed;
+
+		/**
+		 * First exception thrown by an iteration. Rethrown by parallelFor().
+		 */
+		std::exception_ptr _exception;
+
+		/**
+		 * Serializes calls of parallelFor().
+		 */
+		boost::mutex _loopMutex;
+
+		/**
+		 * Pool whose iterations the current thread runs, or null. Used to run nested loops
+		 * serially, which would otherwise wait for _loopMutex or for busy threads forever.
+		 */
+		static boost::thread_specific_ptr<ThreadPool> _current;
+
+		/**
+		 * Cleanup function for _current, which does nothing, since pools are owned by their
+		 * creator.
+		 */
+		static void keep(ThreadPool*);
+
+		/**
+		 * Main function of the worker threads.
+		 *
+		 * @param worker Index of the worker's range
+		 */
+		void workerMain(int worker);
+
+		/**
+		 * Runs iterations until no thread has any iterations left.
+		 *
+		 * @param worker Index of the thread's range
+		 */
+		void work(int worker);
+
+		/**
+		 * Gets the next chunk of iterations to run, either from the own range or stolen from
+		 * another one.
+		 *
+		 * @param worker Index of the thread's range
+		 * @param begin Is set to the first iteration of the chunk
+		 * @param end Is set to the iteration after the chunk
+		 *
+		 * @return True, if iterations were found, false if all ranges are empty.
+		 */
+		bool nextChunk(int worker, int& begin, int& end);
+
+	public:
+
+		/**
+		 * Constructs a new thread pool.
+		 *
+		 * @param threadCount Amount of threads including the calling thread. Values smaller than
+		 * 1 are treated as 1
+		 */
+		ThreadPool(int threadCount);
+
+		/**
+		 * Destructor to free memory. Stops and joins all worker threads.
+		 */
+		virtual ~ThreadPool();
+
+		/**
+		 * Gets the amount of threads including the calling thread.
+		 *
+		 * @return Amount of threads.
+		 */
+		int getThreadCount();
+
+		/**
+		 * Runs task for every index in [0, count) and blocks until all iterations are done.
+		 * Iterations may run concurrently and in any order, so task must only write to state
+		 * owned by its index. If iterations throw, the remaining ones are skipped and the first
+		 * exception is rethrown. If called from within an iteration of any pool, the loop runs
+		 * serially on the calling thread.
+		 *
+		 * @param count Amount of iterations
+		 * @param task Loop body, called with the index of the iteration
+		 */
+		void parallelFor(int count, boost::function<void (int)> task);
+
+};
+
+#endif
@@ -24,6 +24,17 @@ nddlgen::utilities::WorkflowControllerConfig::WorkflowControllerConfig()
 	this->_isdInputFile = "";
 	this->_outputFilesPath = "";
 
+	this->_broadPhase.reset(new nddlgen::math::BoundingVolumeHierarchyBroadPhase());
+	this->_threadCount = 1;
+	this->_parallelObjectCreation = false;
+	this->_parallelRendering = false;
+	this->_incrementalOutput = false;
+	this->_atomicOutput = false;
+	this->_synchronousOutput = false;
+	this->_streamingSdfParsing = false;
+	this->_sceneCacheDirectory = "";
+	this->_sceneCacheSizeLimit = nddlgen::utilities::SceneCache::DEFAULT_SIZE_LIMIT;
+
 	this->_readOnly = false;
 }
 
@@ -77,6 +88,89 @@ void nddlgen::utilities::WorkflowControllerConfig::setObjectFactory(
 
 	this->_objectFactory = modelFactory;
 	this->_objectFactory->registerObjectModels();
+	this->_objectFactory->compileObjectModels();
+}
+
+void nddlgen::utilities::WorkflowControllerConfig::setBroadPhase(
+		nddlgen::math::AbstractBroadPhasePtr broadPhase)
+{
+	this->trySet();
+
+	this->_broadPhase = broadPhase;
+}
+
+void nddlgen::utilities::WorkflowControllerConfig::setThreadCount(int threadCount)
+{
+	this->trySet();
+
+	this->_threadCount = (threadCount < 1) ? 1 : threadCount;
+}
+
+void nddlgen::utilities::WorkflowControllerConfig::setParallelObjectCreation(bool parallelObjectCreation)
+{
+	this->trySet();
+
+	this->_parallelObjectCreation = parallelObjectCreation;
+}
+
+void nddlgen::utilities::WorkflowControllerConfig::setParallelRendering(bool parallelRendering)
+{
+	this->trySet();
+
+	this->_parallelRendering = parallelRendering;
+}
+
+void nddlgen::utilities::WorkflowControllerConfig::setIncrementalOutput(bool incrementalOutput)
+{
+	this->trySet();
+
+	this->_incrementalOutput = incrementalOutput;
+}
+
+void nddlgen::utilities::WorkflowControllerConfig::setAtomicOutput(bool atomicOutput)
+{
+	this->trySet();
+
+	this->_atomicOutput = atomicOutput;
+}
+
+void nddlgen::utilities::WorkflowControllerConfig::setSynchronousOutput(bool synchronousOutput)
+{
+	this->trySet();
+
+	this->_synchronousOutput = synchronousOutput;
+}
+
+void nddlgen::utilities::WorkflowControllerConfig::setCollisionState(
+		nddlgen::controllers::CollisionStatePtr collisionState)
+{
+	this->trySet();
+
+	this->_collisionState = collisionState;
+}
+
+void nddlgen::utilities::WorkflowControllerConfig::setStreamingSdfParsing(bool streamingSdfParsing)
+{
+	this->trySet();
+
+	this->_streamingSdfParsing = streamingSdfParsing;
+}
+
+void nddlgen::utilities::WorkflowControllerConfig::setSceneCacheDirectory(std::string sceneCacheDirectory)
+{
+	this->trySet();
+
+	if (sceneCacheDirectory != "")
+	{
+		this->_sceneCacheDirectory = this->normalizePath(sceneCacheDirectory);
+	}
+}
+
+void nddlgen::utilities::WorkflowControllerConfig::setSceneCacheSizeLimit(boost::uintmax_t sceneCacheSizeLimit)
+{
+	this->trySet();
+
+	this->_sceneCacheSizeLimit = sceneCacheSizeLimit;
 }
 
 void nddlgen::utilities::WorkflowControllerConfig::setReadOnly()
@@ -229,3 +323,58 @@ nddlgen::controllers::AbstractObjectFactoryPtr nddlgen::utilities::WorkflowContr
 {
 	return this->_objectFactory;
 }
+
+nddlgen::math::AbstractBroadPhasePtr nddlgen::utilities::WorkflowControllerConfig::getBroadPhase()
+{
+	return this->_broadPhase;
+}
+
+int nddlgen::utilities::WorkflowControllerConfig::getThreadCount()
+{
+	return this->_threadCount;
+}
+
+bool nddlgen::utilities::WorkflowControllerConfig::isParallelObjectCreation()
+{
+	return this->_parallelObjectCreation;
+}
+
+bool nddlgen::utilities::WorkflowControllerConfig::isParallelRendering()
+{
+	return this->_parallelRendering;
+}
+
+bool nddlgen::utilities::WorkflowControllerConfig::isIncrementalOutput()
+{
+	return this->_incrementalOutput;
+}
+
+bool nddlgen::utilities::WorkflowControllerConfig::isAtomicOutput()
+{
+	return this->_atomicOutput;
+}
+
+bool nddlgen::utilities::WorkflowControllerConfig::isSynchronousOutput()
+{
+	return this->_synchronousOutput;
+}
+
+nddlgen::controllers::CollisionStatePtr nddlgen::utilities::WorkflowControllerConfig::getCollisionState()
+{
+	return this->_collisionState;
+}
+
+bool nddlgen::utilities::WorkflowControllerConfig::isStreamingSdfParsing()
+{
+	return this->_streamingSdfParsing;
+}
+
+std::string nddlgen::utilities::WorkflowControllerConfig::getSceneCacheDirectory()
+{
+	return this->_sceneCacheDirectory;
+}
+
+boost::uintmax_t nddlgen::utilities::WorkflowControllerConfig::getSceneCacheSizeLimit()
+{
+	return this->_sceneCacheSizeLimit;
+}
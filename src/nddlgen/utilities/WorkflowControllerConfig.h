@@ -19,10 +19,17 @@
 
 #include <cstddef>
 
+#include <boost/cstdint.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/shared_ptr.hpp>
 #include <nddlgen/controllers/AbstractObjectFactory.h>
+#include <nddlgen/controllers/CollisionState.h>
 #include <nddlgen/exceptions/ControllerConfigIsReadOnlyException.hpp>
+#include <nddlgen/math/AbstractBroadPhase.h>
+#include <nddlgen/math/BoundingVolumeHierarchyBroadPhase.h>
+#include <nddlgen/math/BruteForceBroadPhase.h>
+#include <nddlgen/math/SweepAndPruneBroadPhase.h>
+#include <nddlgen/utilities/SceneCache.h>
 
 namespace nddlgen
 {
@@ -75,6 +82,61 @@ class nddlgen::utilities::WorkflowControllerConfig
 		 */
 		nddlgen::controllers::AbstractObjectFactoryPtr _objectFactory;
 
+		/**
+		 * Broad phase used to prune pairs of bounding boxes before the collision detection.
+		 */
+		nddlgen::math::AbstractBroadPhasePtr _broadPhase;
+
+		/**
+		 * Amount of threads used for parallelizable steps of the workflow.
+		 */
+		int _threadCount;
+
+		/**
+		 * Flag to instantiate the models of the SDF in parallel.
+		 */
+		bool _parallelObjectCreation;
+
+		/**
+		 * Flag to render NDDL classes and actions in parallel.
+		 */
+		bool _parallelRendering;
+
+		/**
+		 * Flag to leave output files untouched if their content did not change.
+		 */
+		bool _incrementalOutput;
+
+		/**
+		 * Flag to replace output files atomically.
+		 */
+		bool _atomicOutput;
+
+		/**
+		 * Flag to flush atomically replaced output files to disk.
+		 */
+		bool _synchronousOutput;
+
+		/**
+		 * Persistent collision state shared by subsequent workflows, or null.
+		 */
+		nddlgen::controllers::CollisionStatePtr _collisionState;
+
+		/**
+		 * Flag to read the SDF with the streaming parser instead of the SDF library.
+		 */
+		bool _streamingSdfParsing;
+
+		/**
+		 * Directory of the scene cache, or empty if scenes should not be cached.
+		 */
+		std::string _sceneCacheDirectory;
+
+		/**
+		 * Maximum total size of the scene cache in bytes.
+		 */
+		boost::uintmax_t _sceneCacheSizeLimit;
+
 		/**
 		 * Helper for setter functions. Tries to use the setter. May throw, if _readOnly
 		 * was set to true before using a setter.
@@ -145,6 +207,115 @@ class nddlgen::utilities::WorkflowControllerConfig
 		 */
 		void setObjectFactory(nddlgen::controllers::AbstractObjectFactoryPtr modelFactory);
 
+		/**
+		 * Sets the broad phase used to prune collision candidates. Defaults to a bounding
+		 * volume hierarchy. Alternatives are BruteForceBroadPhase, which tests all pairs, and
+		 * SweepAndPruneBroadPhase, which is faster for scenes spread along a single axis.
+		 *
+		 * @param broadPhase Broad phase
+		 */
+		void setBroadPhase(nddlgen::math::AbstractBroadPhasePtr broadPhase);
+
+		/**
+		 * Sets the amount of threads used for parallelizable steps of the workflow, i.e. the
+		 * collision detection and, if enabled, instantiating the models. Defaults to 1, which runs everything serially. The generated
+		 * NDDL does not depend on this value.
+		 *
+		 * @param threadCount Amount of threads (including the calling thread)
+		 */
+		void setThreadCount(int threadCount);
+
+		/**
+		 * Sets whether the models of the SDF are instantiated in parallel, using the threads
+		 * set by setThreadCount(). This includes matching them against the model factory and
+		 * building their bounding boxes. The model factory and the models it creates must
+		 * support being instantiated concurrently. The generated NDDL does not depend on this
+		 * value. Disabled by default.
+		 *
+		 * @param parallelObjectCreation True to instantiate models in parallel, false if not
+		 */
+		void setParallelObjectCreation(bool parallelObjectCreation);
+
+		/**
+		 * Sets whether the NDDL classes and actions of the model file are rendered in
+		 * parallel, using the threads set by setThreadCount(). They are written in the same
+		 * order as when rendered serially, so the generated NDDL does not depend on this
+		 * value. The models created by the model factory must support being rendered
+		 * concurrently. Disabled by default.
+		 *
+		 * @param parallelRendering True to render in parallel, false if not
+		 */
+		void setParallelRendering(bool parallelRendering);
+
+		/**
+		 * Sets whether output files are only written if their content changed. The generated
+		 * NDDL is hashed without the creation date, and the hash is added to the boilerplate.
+		 * If an existing output file carries the same hash, it is left untouched, so its
+		 * modification time only changes along with its content. This does not require
+		 * forcing overwrites, which is only needed to replace a file whose content changed.
+		 * Disabled by default.
+		 *
+		 * @param incrementalOutput True to only write changed files, false to always write them
+		 */
+		void setIncrementalOutput(bool incrementalOutput);
+
+		/**
+		 * Sets whether output files are replaced atomically. The NDDL is generated in memory,
+		 * written to a temporary file in the output directory and renamed to the output file,
+		 * so an interrupted run never leaves a truncated output file behind. Disabled by
+		 * default.
+		 *
+		 * @param atomicOutput True to replace output files atomically, false to write them directly
+		 */
+		void setAtomicOutput(bool atomicOutput);
+
+		/**
+		 * Sets whether atomically replaced output files are flushed to disk before the call
+		 * writing them returns. Without it, a power loss may still lose the file. Only takes
+		 * effect along with setAtomicOutput(). Disabled by default.
+		 *
+		 * @param synchronousOutput True to flush output files to disk, false if not
+		 */
+		void setSynchronousOutput(bool synchronousOutput);
+
+		/**
+		 * Sets a persistent collision state. Passing the same state to the configurations of
+		 * subsequent workflows (e.g. after moving some objects in the SDF) lets them test only
+		 * the objects whose bounding boxes changed. Not set by default.
+		 *
+		 * @param collisionState Collision state
+		 */
+		void setCollisionState(nddlgen::controllers::CollisionStatePtr collisionState);
+
+		/**
+		 * Sets whether the SDF input file is read by a streaming parser, which only extracts
+		 * the elements needed for the domain description instead of building the full document
+		 * tree of the SDF library. Documents the streaming parser can not handle (e.g. with
+		 * included models) are read by the SDF library anyway. Disabled by default.
+		 *
+		 * @param streamingSdfParsing True to use the streaming parser, false if not
+		 */
+		void setStreamingSdfParsing(bool streamingSdfParsing);
+
+		/**
+		 * Sets the directory of the scene cache. If set, the scene extracted from the SDF and ISD
+		 * input files is stored there along with its bounding boxes, keyed by a hash of the
+		 * contents of the input files. As long as the input files do not change, subsequent
+		 * workflows read the scene from the cache instead of parsing the input files again. SDF
+		 * input files including other files are not cached. Not set by default.
+		 *
+		 * @param sceneCacheDirectory Path to the cache directory, created if it does not exist
+		 */
+		void setSceneCacheDirectory(std::string sceneCacheDirectory);
+
+		/**
+		 * Sets the maximum total size of the scene cache. If it is exceeded, the least recently
+		 * used scenes are removed. Defaults to 256 MiB.
+		 *
+		 * @param sceneCacheSizeLimit Size limit in bytes
+		 */
+		void setSceneCacheSizeLimit(boost::uintmax_t sceneCacheSizeLimit);
+
 		/**
 		 * Gets the adapter name.
 		 *
@@ -250,6 +421,83 @@ class nddlgen::utilities::WorkflowControllerConfig
 		 */
 		nddlgen::controllers::AbstractObjectFactoryPtr getObjectFactory();
 
+		/**
+		 * Gets the broad phase.
+		 *
+		 * @return Broad phase.
+		 */
+		nddlgen::math::AbstractBroadPhasePtr getBroadPhase();
+
+		/**
+		 * Gets the amount of threads used for parallelizable steps of the workflow.
+		 *
+		 * @return Amount of threads.
+		 */
+		int getThreadCount();
+
+		/**
+		 * Tests if the models of the SDF are instantiated in parallel.
+		 *
+		 * @return True, if models are instantiated in parallel, false if not.
+		 */
+		bool isParallelObjectCreation();
+
+		/**
+		 * Tests if NDDL classes and actions are rendered in parallel.
+		 *
+		 * @return True, if NDDL classes and actions are rendered in parallel, false if not.
+		 */
+		bool isParallelRendering();
+
+		/**
+		 * Tests if output files are only written if their content changed.
+		 *
+		 * @return True, if only changed files are written, false if all files are written.
+		 */
+		bool isIncrementalOutput();
+
+		/**
+		 * Tests if output files are replaced atomically.
+		 *
+		 * @return True, if output files are replaced atomically, false if they are written directly.
+		 */
+		bool isAtomicOutput();
+
+		/**
+		 * Tests if atomically replaced output files are flushed to disk.
+		 *
+		 * @return True, if output files are flushed to disk, false if not.
+		 */
+		bool isSynchronousOutput();
+
+		/**
+		 * Gets the persistent collision state.
+		 *
+		 * @return Collision state, or null if not set.
+		 */
+		nddlgen::controllers::CollisionStatePtr getCollisionState();
+
+		/**
+		 * Tests if the SDF input file is read by the streaming parser.
+		 *
+		 * @return True, if the streaming parser is used, false if not.
+		 */
+		bool isStreamingSdfParsing();
+
+		/**
+		 * Gets the directory of the scene cache.
+		 *
+		 * @return Path to the cache directory, or empty if scenes are not cached.
+		 */
+		std::string getSceneCacheDirectory();
+
+		/**
+		 * Gets the maximum total size of the scene cache.
+		 *
+		 * @return Size limit in bytes.
+		 */
+		boost::uintmax_t getSceneCacheSizeLimit();
+
 		/**
 		 * Tests if this instance has been marked as read only.
 		 *